@@ -1,12 +1,21 @@
 #include <napi.h>
 #include "cisv/parser.h"
 #include "cisv/transformer.h"
+#include "cisv/interner.h"
 #include <vector>
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
 
 namespace {
 
@@ -185,18 +194,50 @@ static Napi::String SafeNewString(Napi::Env env, const char* data, size_t len) {
     return Napi::String(env, SafeNewStringValue(env, data, len));
 }
 
+// =============================================================================
+// String interning for low-cardinality columns (see cisv/interner.h). The
+// cached handles belong to the current handle scope, so an interner kept
+// across native calls is cleared at the start of each one.
+// =============================================================================
+
+class StringInterner {
+public:
+    napi_value Get(napi_env env, size_t column, const char *data, size_t len) {
+        return impl_.get(column, data, len, [env](const char *d, size_t n) {
+            return SafeNewStringValue(env, d, n);
+        });
+    }
+
+    void Clear() { impl_.clear(); }
+
+private:
+    cisv::StringInterner<napi_value> impl_;
+};
+
+// Batched JS transform: one call per batch of a column's values. Values are
+// queued as (row, column) positions and rewritten in place once the function
+// returns, so each batch costs one boundary crossing instead of one per cell.
+struct JsBatchTransform {
+    Napi::FunctionReference fn;
+    size_t batch_size;
+    std::vector<std::pair<size_t, size_t>> pending;
+};
+
 // Extended RowCollector that handles transforms
 struct RowCollector {
     std::vector<std::string> current;
     std::vector<std::vector<std::string>> rows;
     cisv_transform_pipeline_t* pipeline;
     int current_field_index;
+    uint64_t next_row;   // AES row number, kept across parses and pipelines
 
     // JavaScript transforms stored separately
     std::unordered_map<int, Napi::FunctionReference> js_transforms;
+    std::unordered_map<int, JsBatchTransform> js_batch_transforms;
+    StringInterner batch_interner;  // Values passed to batch functions
     Napi::Env env;
 
-    RowCollector() : pipeline(nullptr), current_field_index(0), env(nullptr) {
+    RowCollector() : pipeline(nullptr), current_field_index(0), next_row(0), env(nullptr) {
         // DON'T create the pipeline here - do it lazily when needed
         pipeline = nullptr;
     }
@@ -218,6 +259,10 @@ struct RowCollector {
             }
         }
         js_transforms.clear();
+        for (auto& pair : js_batch_transforms) {
+            pair.second.fn.Reset();
+        }
+        js_batch_transforms.clear();
         rows.clear();
         current.clear();
         current_field_index = 0;
@@ -228,6 +273,9 @@ struct RowCollector {
     void ensurePipeline() {
         if (!pipeline) {
             pipeline = cisv_transform_pipeline_create(16);
+            // Rows keep counting where the last pipeline stopped, so a key
+            // and IV never see the same (field, row) nonce twice
+            if (pipeline) cisv_transform_pipeline_set_row(pipeline, next_row);
         }
     }
 
@@ -306,6 +354,96 @@ struct RowCollector {
 
         return result;
     }
+
+    bool hasJsTransforms() const {
+        return !js_transforms.empty() || !js_batch_transforms.empty();
+    }
+
+    // Queue the field just appended to current for the batched transforms
+    void queueBatchedField(int field_index) {
+        size_t row = rows.size();
+        size_t column = current.size() - 1;
+        auto it = js_batch_transforms.find(field_index);
+        if (it != js_batch_transforms.end()) it->second.pending.emplace_back(row, column);
+        it = js_batch_transforms.find(-1);
+        if (it != js_batch_transforms.end()) it->second.pending.emplace_back(row, column);
+    }
+
+    // Run batched transforms. Unless all is set this waits for a full batch,
+    // then flushes every transform so a value sees its column's function
+    // before the all-fields one, as in applyTransforms(). Only values of
+    // finished rows are flushed; those of the row being parsed stay queued.
+    // Returns false when a batch function threw: its exception is left
+    // pending for the caller to return to JS, and the queued values dropped.
+    bool flushBatchTransforms(Napi::Env call_env, bool all) {
+        if (call_env.IsExceptionPending()) {
+            dropPendingBatches();
+            return false;
+        }
+        if (!all) {
+            bool full = false;
+            for (const auto &pair : js_batch_transforms) {
+                if (pair.second.pending.size() >= pair.second.batch_size) full = true;
+            }
+            if (!full) return true;
+        }
+        batch_interner.Clear();
+        bool ok = true;
+        for (auto &pair : js_batch_transforms) {
+            if (ok && pair.first >= 0) ok = runBatchTransform(call_env, pair.first, pair.second);
+        }
+        auto it_all = js_batch_transforms.find(-1);
+        if (ok && it_all != js_batch_transforms.end()) ok = runBatchTransform(call_env, -1, it_all->second);
+        if (!ok) dropPendingBatches();
+        return ok;
+    }
+
+    bool runBatchTransform(Napi::Env call_env, int field_index, JsBatchTransform &bt) {
+        // Positions are queued in row order, so the unfinished row is a suffix
+        size_t ready = bt.pending.size();
+        while (ready > 0 && bt.pending[ready - 1].first >= rows.size()) ready--;
+
+        for (size_t start = 0; start < ready; start += bt.batch_size) {
+            size_t count = std::min(bt.batch_size, ready - start);
+            try {
+                napi_value values;
+                napi_create_array_with_length(call_env, count, &values);
+                for (size_t i = 0; i < count; i++) {
+                    const auto &pos = bt.pending[start + i];
+                    const std::string &value = rows[pos.first][pos.second];
+                    napi_set_element(call_env, values, i,
+                        batch_interner.Get(call_env, field_index + 1, value.data(), value.size()));
+                }
+
+                Napi::Value js_result = bt.fn.Call({values, Napi::Number::New(call_env, field_index)});
+                if (call_env.IsExceptionPending()) return false;
+                if (!js_result.IsArray()) continue;
+
+                Napi::Array out = js_result.As<Napi::Array>();
+                size_t n = std::min<size_t>(count, out.Length());
+                for (size_t i = 0; i < n; i++) {
+                    Napi::Value v = out[static_cast<uint32_t>(i)];
+                    if (v.IsString()) {
+                        const auto &pos = bt.pending[start + i];
+                        rows[pos.first][pos.second] = v.As<Napi::String>().Utf8Value();
+                    }
+                }
+                if (call_env.IsExceptionPending()) return false;
+            } catch (const Napi::Error& e) {
+                e.ThrowAsJavaScriptException();
+                return false;
+            } catch (const std::exception& e) {
+                Napi::Error::New(call_env, e.what()).ThrowAsJavaScriptException();
+                return false;
+            }
+        }
+        bt.pending.erase(bt.pending.begin(), bt.pending.begin() + ready);
+        return true;
+    }
+
+    void dropPendingBatches() {
+        for (auto &pair : js_batch_transforms) pair.second.pending.clear();
+    }
 };
 
 static void field_cb(void *user, const char *data, size_t len) {
@@ -313,7 +451,7 @@ static void field_cb(void *user, const char *data, size_t len) {
 
     // Fast path: no transforms - avoid unnecessary string copies
     bool has_c_transforms = rc->pipeline && rc->pipeline->count > 0;
-    bool has_js_transforms = !rc->js_transforms.empty();
+    bool has_js_transforms = rc->hasJsTransforms();
 
     if (!has_c_transforms && !has_js_transforms) {
         rc->current.emplace_back(data, len);
@@ -324,6 +462,7 @@ static void field_cb(void *user, const char *data, size_t len) {
     // Slow path: apply transforms
     std::string transformed = rc->applyTransforms(data, len, rc->current_field_index);
     rc->current.emplace_back(std::move(transformed));
+    if (!rc->js_batch_transforms.empty()) rc->queueBatchedField(rc->current_field_index);
     rc->current_field_index++;
 }
 
@@ -332,6 +471,9 @@ static void row_cb(void *user) {
     rc->rows.emplace_back(std::move(rc->current));
     rc->current.clear();
     rc->current_field_index = 0;  // Reset field index for next row
+    // Transformed fields were copied out; recycle the pipeline pool
+    if (rc->pipeline) cisv_transform_pipeline_reset(rc->pipeline);
+    if (!rc->js_batch_transforms.empty() && rc->env) rc->flushBatchTransforms(rc->env, false);
 }
 
 static void error_cb(void *user, int line, const char *msg) {
@@ -339,17 +481,307 @@ static void error_cb(void *user, int line, const char *msg) {
     fprintf(stderr, "CSV Parse Error at line %d: %s\n", line, msg);
 }
 
+// =============================================================================
+// Row views: zero-copy results
+// A parse result is packed into two blocks that become external ArrayBuffers:
+// the field bytes, and an index of field offsets, field lengths and row starts
+// (row_count + 1 field indices). JS strings are created only for the fields
+// that are read. Index entries are uint32 until the data or the field count
+// outgrows 32 bits, then double (exact up to 2^53).
+// =============================================================================
+
+struct RowViewData {
+    char *data = nullptr;      // Field bytes (batch results keep a NUL after each field)
+    size_t data_size = 0;      // Bytes in data
+    void *index = nullptr;     // offsets[field_count], lengths[field_count], starts[row_count + 1]
+    bool wide = false;         // index holds doubles instead of uint32
+    size_t field_count = 0;    // Fields across all rows
+    size_t row_count = 0;      // Rows
+
+    ~RowViewData() { release(); }
+
+    void release() {
+        free(data);
+        free(index);
+        data = nullptr;
+        index = nullptr;
+    }
+};
+
+static bool AllocRowViewIndex(RowViewData *out, size_t data_size, size_t fields, size_t rows) {
+    out->wide = data_size > UINT32_MAX || fields > UINT32_MAX;
+    size_t elem = out->wide ? sizeof(double) : sizeof(uint32_t);
+    if (fields > (SIZE_MAX / elem - rows - 1) / 2) return false;
+    out->index = malloc((2 * fields + rows + 1) * elem);
+    out->field_count = fields;
+    out->row_count = rows;
+    return out->index != nullptr;
+}
+
+template <typename T>
+static void FillBatchIndex(T *index, const cisv_result_t *result) {
+    T *offsets = index;
+    T *lengths = index + result->total_fields;
+    T *starts = lengths + result->total_fields;
+    for (size_t i = 0; i < result->total_fields; i++) {
+        offsets[i] = static_cast<T>(result->all_fields[i] - result->field_data);
+        lengths[i] = static_cast<T>(result->all_lengths[i]);
+    }
+    size_t start = 0;
+    for (size_t r = 0; r < result->row_count; r++) {
+        starts[r] = static_cast<T>(start);
+        start += result->rows[r].field_count;
+    }
+    starts[result->row_count] = static_cast<T>(start);
+}
+
+// Pack a batch result, taking over its field storage. The result is freed
+// either way. Safe to call off the main thread.
+static bool PackBatchResult(cisv_result_t *result, RowViewData *out) {
+    if (!AllocRowViewIndex(out, result->field_data_size, result->total_fields, result->row_count)) {
+        cisv_result_free(result);
+        return false;
+    }
+    if (out->wide) {
+        FillBatchIndex(static_cast<double *>(out->index), result);
+    } else {
+        FillBatchIndex(static_cast<uint32_t *>(out->index), result);
+    }
+    out->data = result->field_data;
+    out->data_size = result->field_data_size;
+    result->field_data = nullptr;
+    cisv_result_free(result);
+    return true;
+}
+
+template <typename T>
+static void FillRowsIndex(T *index, char *data, size_t fields,
+                          const std::vector<std::vector<std::string>> &rows) {
+    T *offsets = index;
+    T *lengths = index + fields;
+    T *starts = lengths + fields;
+    size_t field = 0;
+    size_t offset = 0;
+    for (size_t r = 0; r < rows.size(); r++) {
+        starts[r] = static_cast<T>(field);
+        for (const std::string &value : rows[r]) {
+            memcpy(data + offset, value.data(), value.size());
+            offsets[field] = static_cast<T>(offset);
+            lengths[field] = static_cast<T>(value.size());
+            offset += value.size();
+            field++;
+        }
+    }
+    starts[rows.size()] = static_cast<T>(field);
+}
+
+// Pack rows collected through callbacks (the transform path)
+static bool PackRows(const std::vector<std::vector<std::string>> &rows, RowViewData *out) {
+    size_t fields = 0;
+    size_t size = 0;
+    for (const auto &row : rows) {
+        fields += row.size();
+        for (const std::string &value : row) size += value.size();
+    }
+    out->data = static_cast<char *>(malloc(size ? size : 1));
+    if (!out->data || !AllocRowViewIndex(out, size, fields, rows.size())) {
+        out->release();
+        return false;
+    }
+    out->data_size = size;
+    if (out->wide) {
+        FillRowsIndex(static_cast<double *>(out->index), out->data, fields, rows);
+    } else {
+        FillRowsIndex(static_cast<uint32_t *>(out->index), out->data, fields, rows);
+    }
+    return true;
+}
+
+static void FreeExternal(Napi::Env, void *data) {
+    free(data);
+}
+
+class CisvRowView final : public Napi::ObjectWrap<CisvRowView> {
+public:
+    static void Init(Napi::Env env) {
+        Napi::Function func = DefineClass(env, "CisvRowView", {
+            InstanceMethod("get", &CisvRowView::Get),
+            InstanceMethod("row", &CisvRowView::Row),
+            InstanceMethod("fieldCount", &CisvRowView::FieldCount),
+            InstanceMethod("toArray", &CisvRowView::ToArray)
+        });
+        env.SetInstanceData<Napi::FunctionReference>(
+            new Napi::FunctionReference(Napi::Persistent(func)));
+    }
+
+    // Hand packed rows to JS. Ownership of both blocks moves to the
+    // ArrayBuffers, which free them when collected.
+    static Napi::Value New(Napi::Env env, RowViewData &packed) {
+        size_t elem = packed.wide ? sizeof(double) : sizeof(uint32_t);
+        size_t index_len = 2 * packed.field_count + packed.row_count + 1;
+
+        Napi::ArrayBuffer data = Napi::ArrayBuffer::New(
+            env, packed.data, packed.data_size, FreeExternal);
+        packed.data = nullptr;
+        Napi::ArrayBuffer index = Napi::ArrayBuffer::New(
+            env, packed.index, index_len * elem, FreeExternal);
+        packed.index = nullptr;
+
+        Napi::Object view = env.GetInstanceData<Napi::FunctionReference>()->New({
+            data, index,
+            Napi::Boolean::New(env, packed.wide),
+            Napi::Number::New(env, static_cast<double>(packed.field_count)),
+            Napi::Number::New(env, static_cast<double>(packed.row_count))
+        });
+        return view;
+    }
+
+    CisvRowView(const Napi::CallbackInfo &info) : Napi::ObjectWrap<CisvRowView>(info) {
+        Napi::Env env = info.Env();
+
+        if (info.Length() != 5 || !info[0].IsArrayBuffer() || !info[1].IsArrayBuffer()) {
+            throw Napi::TypeError::New(env, "CisvRowView is created by the parser");
+        }
+
+        Napi::ArrayBuffer data = info[0].As<Napi::ArrayBuffer>();
+        Napi::ArrayBuffer index = info[1].As<Napi::ArrayBuffer>();
+        wide_ = info[2].As<Napi::Boolean>();
+        field_count_ = static_cast<size_t>(info[3].As<Napi::Number>().DoubleValue());
+        row_count_ = static_cast<size_t>(info[4].As<Napi::Number>().DoubleValue());
+
+        data_ = static_cast<const char *>(data.Data());
+        index_ = index.Data();
+        data_ref_ = Napi::Persistent(data);
+        index_ref_ = Napi::Persistent(index);
+
+        size_t elem = wide_ ? sizeof(double) : sizeof(uint32_t);
+        Napi::Value offsets, lengths, starts;
+        if (wide_) {
+            offsets = Napi::Float64Array::New(env, field_count_, index, 0);
+            lengths = Napi::Float64Array::New(env, field_count_, index, field_count_ * elem);
+            starts = Napi::Float64Array::New(env, row_count_ + 1, index, 2 * field_count_ * elem);
+        } else {
+            offsets = Napi::Uint32Array::New(env, field_count_, index, 0);
+            lengths = Napi::Uint32Array::New(env, field_count_, index, field_count_ * elem);
+            starts = Napi::Uint32Array::New(env, row_count_ + 1, index, 2 * field_count_ * elem);
+        }
+
+        info.This().As<Napi::Object>().DefineProperties({
+            Napi::PropertyDescriptor::Value("buffer", data, napi_enumerable),
+            Napi::PropertyDescriptor::Value("offsets", offsets, napi_enumerable),
+            Napi::PropertyDescriptor::Value("lengths", lengths, napi_enumerable),
+            Napi::PropertyDescriptor::Value("rowStarts", starts, napi_enumerable),
+            Napi::PropertyDescriptor::Value("rowCount",
+                Napi::Number::New(env, static_cast<double>(row_count_)), napi_enumerable)
+        });
+    }
+
+private:
+    size_t IndexAt(size_t i) const {
+        return wide_ ? static_cast<size_t>(static_cast<const double *>(index_)[i])
+                     : static_cast<const uint32_t *>(index_)[i];
+    }
+
+    size_t RowStart(size_t row) const { return IndexAt(2 * field_count_ + row); }
+
+    // Row argument, or row_count_ when it is missing or out of range
+    size_t RowArg(const Napi::CallbackInfo &info, size_t i) const {
+        if (info.Length() <= i || !info[i].IsNumber()) return row_count_;
+        double row = info[i].As<Napi::Number>().DoubleValue();
+        if (!(row >= 0) || row >= static_cast<double>(row_count_)) return row_count_;
+        return static_cast<size_t>(row);
+    }
+
+    napi_value Field(napi_env env, size_t field) const {
+        return SafeNewStringValue(env, data_ + IndexAt(field), IndexAt(field_count_ + field));
+    }
+
+    // interner may be null: a single row has one value per column to share
+    napi_value RowArray(napi_env env, size_t row, StringInterner *interner) const {
+        size_t start = RowStart(row);
+        size_t count = RowStart(row + 1) - start;
+        napi_value out;
+        napi_create_array_with_length(env, count, &out);
+        for (size_t j = 0; j < count; j++) {
+            size_t field = start + j;
+            const char *data = data_ + IndexAt(field);
+            size_t len = IndexAt(field_count_ + field);
+            napi_set_element(env, out, j,
+                interner ? interner->Get(env, j, data, len) : SafeNewStringValue(env, data, len));
+        }
+        return out;
+    }
+
+    // get(row, column): the field as a string, undefined when out of range
+    Napi::Value Get(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+        size_t row = RowArg(info, 0);
+        if (row == row_count_ || info.Length() < 2 || !info[1].IsNumber()) {
+            return env.Undefined();
+        }
+        double column = info[1].As<Napi::Number>().DoubleValue();
+        size_t start = RowStart(row);
+        if (!(column >= 0) || column >= static_cast<double>(RowStart(row + 1) - start)) {
+            return env.Undefined();
+        }
+        return Napi::Value(env, Field(env, start + static_cast<size_t>(column)));
+    }
+
+    // row(i): one row decoded to strings, undefined when out of range
+    Napi::Value Row(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+        size_t row = RowArg(info, 0);
+        if (row == row_count_) return env.Undefined();
+        return Napi::Value(env, RowArray(env, row, nullptr));
+    }
+
+    // fieldCount(i): number of fields in a row (0 when out of range)
+    Napi::Value FieldCount(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+        size_t row = RowArg(info, 0);
+        if (row == row_count_) return Napi::Number::New(env, 0);
+        return Napi::Number::New(env, static_cast<double>(RowStart(row + 1) - RowStart(row)));
+    }
+
+    // toArray(): every row decoded, same shape as parseSync()
+    Napi::Value ToArray(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+        StringInterner interner;
+        napi_value rows;
+        napi_create_array_with_length(env, row_count_, &rows);
+        for (size_t i = 0; i < row_count_; i++) {
+            napi_set_element(env, rows, i, RowArray(env, i, &interner));
+        }
+        return Napi::Value(env, rows);
+    }
+
+    const char *data_ = nullptr;
+    const void *index_ = nullptr;
+    bool wide_ = false;
+    size_t field_count_ = 0;
+    size_t row_count_ = 0;
+    Napi::Reference<Napi::ArrayBuffer> data_ref_;
+    Napi::Reference<Napi::ArrayBuffer> index_ref_;
+};
+
 class ParseFileWorker final : public Napi::AsyncWorker {
 public:
     ParseFileWorker(
         Napi::Env env,
         std::string path,
         cisv_config config,
+        bool view,
         Napi::Promise::Deferred deferred
     ) : Napi::AsyncWorker(env),
         path_(std::move(path)),
         config_(config),
-        deferred_(deferred) {}
+        view_(view),
+        deferred_(deferred),
+        result_(nullptr) {}
+
+    ~ParseFileWorker() override {
+        cisv_result_free(result_);
+    }
 
     void Execute() override {
         cisv_result_t *result = cisv_parse_file_batch(path_.c_str(), &config_);
@@ -368,34 +800,42 @@ public:
             return;
         }
 
-        rows_.reserve(result->row_count);
-        for (size_t i = 0; i < result->row_count; i++) {
-            cisv_row_t *row = &result->rows[i];
-            std::vector<std::string> out_row;
-            out_row.reserve(row->field_count);
-            for (size_t j = 0; j < row->field_count; j++) {
-                out_row.emplace_back(row->fields[j], row->field_lengths[j]);
+        // Views are packed here so the main thread only wraps the buffers;
+        // plain rows are built straight from the result in OnOK
+        if (view_) {
+            if (!PackBatchResult(result, &packed_)) {
+                SetError("parse error: out of memory");
             }
-            rows_.emplace_back(std::move(out_row));
+            return;
         }
-
-        cisv_result_free(result);
+        result_ = result;
     }
 
     void OnOK() override {
         Napi::Env env = Env();
-        Napi::Array out = Napi::Array::New(env, rows_.size());
 
-        for (size_t i = 0; i < rows_.size(); i++) {
-            Napi::Array row = Napi::Array::New(env, rows_[i].size());
-            for (size_t j = 0; j < rows_[i].size(); j++) {
-                const std::string &field = rows_[i][j];
-                row[j] = SafeNewString(env, field.c_str(), field.length());
+        if (view_) {
+            deferred_.Resolve(CisvRowView::New(env, packed_));
+            return;
+        }
+
+        StringInterner interner;
+        napi_value out;
+        napi_create_array_with_length(env, result_->row_count, &out);
+        for (size_t i = 0; i < result_->row_count; i++) {
+            const cisv_row_t *src_row = &result_->rows[i];
+            napi_value row;
+            napi_create_array_with_length(env, src_row->field_count, &row);
+            for (size_t j = 0; j < src_row->field_count; j++) {
+                napi_set_element(env, row, j,
+                    interner.Get(env, j, src_row->fields[j], src_row->field_lengths[j]));
             }
-            out[i] = row;
+            napi_set_element(env, out, i, row);
         }
+        cisv_result_free(result_);
+        result_ = nullptr;
 
-        deferred_.Resolve(out);
+        deferred_.Resolve(Napi::Value(env, out));
     }
 
     void OnError(const Napi::Error &e) override {
@@ -405,8 +845,10 @@ public:
 private:
     std::string path_;
     cisv_config config_;
+    bool view_;
     Napi::Promise::Deferred deferred_;
-    std::vector<std::vector<std::string>> rows_;
+    cisv_result_t *result_;
+    RowViewData packed_;
 };
 
 } // namespace
@@ -418,11 +860,16 @@ public:
             InstanceMethod("parseSync", &CisvParser::ParseSync),
             InstanceMethod("parse", &CisvParser::ParseAsync),
             InstanceMethod("parseString", &CisvParser::ParseString),
+            InstanceMethod("parseViewSync", &CisvParser::ParseViewSync),
+            InstanceMethod("parseView", &CisvParser::ParseViewAsync),
+            InstanceMethod("parseStringView", &CisvParser::ParseStringView),
             InstanceMethod("write", &CisvParser::Write),
             InstanceMethod("end", &CisvParser::End),
             InstanceMethod("getRows", &CisvParser::GetRows),
+            InstanceMethod("getRowsView", &CisvParser::GetRowsView),
             InstanceMethod("clear", &CisvParser::Clear),
             InstanceMethod("transform", &CisvParser::Transform),
+            InstanceMethod("transformBatch", &CisvParser::TransformBatch),
             InstanceMethod("removeTransform", &CisvParser::RemoveTransform),
             InstanceMethod("clearTransforms", &CisvParser::ClearTransforms),
             InstanceMethod("getStats", &CisvParser::GetStats),
@@ -433,10 +880,12 @@ public:
             InstanceMethod("transformByName", &CisvParser::TransformByName),
             InstanceMethod("setHeaderFields", &CisvParser::SetHeaderFields),
             InstanceMethod("removeTransformByName", &CisvParser::RemoveTransformByName),
+            InstanceMethod("setRow", &CisvParser::SetRow),
 
             // Iterator API methods
             InstanceMethod("openIterator", &CisvParser::OpenIterator),
             InstanceMethod("fetchRow", &CisvParser::FetchRow),
+            InstanceMethod("fetchRows", &CisvParser::FetchRows),
             InstanceMethod("closeIterator", &CisvParser::CloseIterator),
 
             StaticMethod("countRows", &CisvParser::CountRows),
@@ -464,7 +913,7 @@ public:
         // Handle constructor options if provided
         if (info.Length() > 0 && info[0].IsObject()) {
             Napi::Object options = info[0].As<Napi::Object>();
-            ApplyConfigFromObject(options);
+            ApplyConfigFromObject(config_, options);
         }
 
         // Set callbacks
@@ -482,14 +931,14 @@ public:
     }
 
     // Apply configuration from JavaScript object
-    void ApplyConfigFromObject(Napi::Object options) {
+    static void ApplyConfigFromObject(cisv_config &config, Napi::Object options) {
         // Delimiter
         if (options.Has("delimiter")) {
             Napi::Value delim = options.Get("delimiter");
             if (delim.IsString()) {
                 std::string delim_str = delim.As<Napi::String>();
                 if (!delim_str.empty()) {
-                    config_.delimiter = delim_str[0];
+                    config.delimiter = delim_str[0];
                 }
             }
         }
@@ -500,7 +949,7 @@ public:
             if (quote.IsString()) {
                 std::string quote_str = quote.As<Napi::String>();
                 if (!quote_str.empty()) {
-                    config_.quote = quote_str[0];
+                    config.quote = quote_str[0];
                 }
             }
         }
@@ -511,10 +960,10 @@ public:
             if (escape.IsString()) {
                 std::string escape_str = escape.As<Napi::String>();
                 if (!escape_str.empty()) {
-                    config_.escape = escape_str[0];
+                    config.escape = escape_str[0];
                 }
             } else if (escape.IsNull() || escape.IsUndefined()) {
-                config_.escape = 0; // RFC4180 style
+                config.escape = 0; // RFC4180 style
             }
         }
 
@@ -524,42 +973,42 @@ public:
             if (comment.IsString()) {
                 std::string comment_str = comment.As<Napi::String>();
                 if (!comment_str.empty()) {
-                    config_.comment = comment_str[0];
+                    config.comment = comment_str[0];
                 }
             }
         }
 
         // Boolean options
         if (options.Has("skipEmptyLines")) {
-            config_.skip_empty_lines = options.Get("skipEmptyLines").As<Napi::Boolean>();
+            config.skip_empty_lines = options.Get("skipEmptyLines").As<Napi::Boolean>();
         }
 
         if (options.Has("trim")) {
-            config_.trim = options.Get("trim").As<Napi::Boolean>();
+            config.trim = options.Get("trim").As<Napi::Boolean>();
         }
 
         if (options.Has("relaxed")) {
-            config_.relaxed = options.Get("relaxed").As<Napi::Boolean>();
+            config.relaxed = options.Get("relaxed").As<Napi::Boolean>();
         }
 
         if (options.Has("skipLinesWithError")) {
-            config_.skip_lines_with_error = options.Get("skipLinesWithError").As<Napi::Boolean>();
+            config.skip_lines_with_error = options.Get("skipLinesWithError").As<Napi::Boolean>();
         }
 
         // Numeric options
         if (options.Has("maxRowSize")) {
             Napi::Value val = options.Get("maxRowSize");
             if (!val.IsNull() && !val.IsUndefined()) {
-                config_.max_row_size = val.As<Napi::Number>().Uint32Value();
+                config.max_row_size = val.As<Napi::Number>().Uint32Value();
             }
         }
 
         if (options.Has("fromLine")) {
-            config_.from_line = options.Get("fromLine").As<Napi::Number>().Int32Value();
+            config.from_line = options.Get("fromLine").As<Napi::Number>().Int32Value();
         }
 
         if (options.Has("toLine")) {
-            config_.to_line = options.Get("toLine").As<Napi::Number>().Int32Value();
+            config.to_line = options.Get("toLine").As<Napi::Number>().Int32Value();
         }
     }
 
@@ -576,7 +1025,7 @@ public:
         }
 
         Napi::Object options = info[0].As<Napi::Object>();
-        ApplyConfigFromObject(options);
+        ApplyConfigFromObject(config_, options);
 
         // Recreate parser with new configuration
         if (parser_) {
@@ -660,95 +1109,26 @@ public:
 
     // Synchronous file parsing
     Napi::Value ParseSync(const Napi::CallbackInfo &info) {
-        Napi::Env env = info.Env();
-
-        if (is_destroyed_) {
-            throw Napi::Error::New(env, "Parser has been destroyed");
-        }
-
-        if (info.Length() != 1 || !info[0].IsString()) {
-            throw Napi::TypeError::New(env, "Expected file path string");
-        }
-
-        std::string path = info[0].As<Napi::String>();
-
-        auto start = std::chrono::high_resolution_clock::now();
-
-        resetRowState();
-
-        int result = 0;
-        if (!hasTransforms()) {
-            cisv_result_t *batch = cisv_parse_file_batch(path.c_str(), &config_);
-            if (!batch) {
-                throw Napi::Error::New(env, "parse error: " + std::string(strerror(errno)));
-            }
-            if (batch->error_code != 0) {
-                std::string msg = batch->error_message[0] ? batch->error_message : "parse error";
-                cisv_result_free(batch);
-                throw Napi::Error::New(env, msg);
-            }
-            clearBatchResult();
-            batch_result_ = batch;
-        } else {
-            // Set environment for JS transforms
-            rc_->env = env;
-            result = cisv_parser_parse_file(parser_, path.c_str());
-            // Clear the environment reference after parsing
-            rc_->env = nullptr;
-            if (result < 0) {
-                throw Napi::Error::New(env, "parse error: " + std::to_string(result));
-            }
-        }
-
-        auto end = std::chrono::high_resolution_clock::now();
-        parse_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        parseFile(info);
+        return drainRows(info.Env());
+    }
 
-        return drainRows(env);
+    // Synchronous file parsing into a CisvRowView
+    Napi::Value ParseViewSync(const Napi::CallbackInfo &info) {
+        parseFile(info);
+        return takeRowView(info.Env());
     }
 
     // Parse string content
     Napi::Value ParseString(const Napi::CallbackInfo &info) {
-        Napi::Env env = info.Env();
-
-        if (is_destroyed_) {
-            throw Napi::Error::New(env, "Parser has been destroyed");
-        }
-
-        if (info.Length() != 1 || !info[0].IsString()) {
-            throw Napi::TypeError::New(env, "Expected CSV string");
-        }
-
-        std::string content = info[0].As<Napi::String>();
-
-        resetRowState();
-
-        if (!hasTransforms()) {
-            cisv_result_t *batch = cisv_parse_string_batch(content.c_str(), content.length(), &config_);
-            if (!batch) {
-                throw Napi::Error::New(env, "parse error: " + std::string(strerror(errno)));
-            }
-            if (batch->error_code != 0) {
-                std::string msg = batch->error_message[0] ? batch->error_message : "parse error";
-                cisv_result_free(batch);
-                throw Napi::Error::New(env, msg);
-            }
-            clearBatchResult();
-            batch_result_ = batch;
-        } else {
-            // Set environment for JS transforms
-            rc_->env = env;
-
-            // Write the string content as chunks
-            cisv_parser_write(parser_, (const uint8_t*)content.c_str(), content.length());
-            cisv_parser_end(parser_);
-
-            // Clear the environment reference after parsing
-            rc_->env = nullptr;
-        }
-
-        total_bytes_ = content.length();
+        parseString(info);
+        return drainRows(info.Env());
+    }
 
-        return drainRows(env);
+    // Parse string content into a CisvRowView
+    Napi::Value ParseStringView(const Napi::CallbackInfo &info) {
+        parseString(info);
+        return takeRowView(info.Env());
     }
 
     // Write chunk for streaming
@@ -866,12 +1246,26 @@ public:
         return drainRows(info.Env());
     }
 
+    // Like getRows(), but hands the rows over as a CisvRowView
+    Napi::Value GetRowsView(const Napi::CallbackInfo &info) {
+        if (is_destroyed_) {
+            Napi::Env env = info.Env();
+            throw Napi::Error::New(env, "Parser has been destroyed");
+        }
+        if (!pending_stream_.empty()) {
+            flushPendingStreamToParser();
+            stream_buffering_active_ = false;
+        }
+        return takeRowView(info.Env());
+    }
+
     void Clear(const Napi::CallbackInfo &info) {
         if (!is_destroyed_ && rc_) {
             clearBatchResult();
             rc_->rows.clear();
             rc_->current.clear();
             rc_->current_field_index = 0;
+            rc_->dropPendingBatches();
             total_bytes_ = 0;
             parse_time_ = 0;
             pending_stream_.clear();
@@ -923,6 +1317,18 @@ public:
                 type = TRANSFORM_TO_FLOAT;
             } else if (transform_type == "hash_sha256" || transform_type == "sha256") {
                 type = TRANSFORM_HASH_SHA256;
+            } else if (transform_type == "hash_md5" || transform_type == "md5") {
+                type = TRANSFORM_HASH_MD5;
+            } else if (transform_type == "hash_xxh3" || transform_type == "xxh3") {
+                type = TRANSFORM_HASH_XXH3;
+            } else if (transform_type == "encrypt_aes256" || transform_type == "encrypt") {
+                type = TRANSFORM_ENCRYPT_AES256;
+            } else if (transform_type == "decrypt_aes256" || transform_type == "decrypt") {
+                type = TRANSFORM_DECRYPT_AES256;
+            } else if (transform_type == "encrypt_aes256_ctr") {
+                type = TRANSFORM_ENCRYPT_AES256_CTR;
+            } else if (transform_type == "decrypt_aes256_ctr") {
+                type = TRANSFORM_DECRYPT_AES256_CTR;
             } else if (transform_type == "base64_encode" || transform_type == "base64") {
                 type = TRANSFORM_BASE64_ENCODE;
             } else {
@@ -993,6 +1399,37 @@ public:
         return info.This();  // Return this for chaining
     }
 
+    // Add a batched JavaScript transform: fn(values: string[], fieldIndex)
+    // returns the transformed values, called with up to batchSize values
+    Napi::Value TransformBatch(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+
+        if (is_destroyed_) {
+            throw Napi::Error::New(env, "Parser has been destroyed");
+        }
+
+        if (info.Length() < 2 || !info[0].IsNumber() || !info[1].IsFunction()) {
+            throw Napi::TypeError::New(env, "Expected field index and transform function");
+        }
+
+        int field_index = info[0].As<Napi::Number>().Int32Value();
+        size_t batch_size = 1024;
+        if (info.Length() >= 3 && info[2].IsNumber()) {
+            double n = info[2].As<Napi::Number>().DoubleValue();
+            if (!(n >= 1)) {
+                throw Napi::RangeError::New(env, "Batch size must be at least 1");
+            }
+            batch_size = static_cast<size_t>(n);
+        }
+
+        JsBatchTransform &bt = rc_->js_batch_transforms[field_index];
+        bt.fn = Napi::Persistent(info[1].As<Napi::Function>());
+        bt.batch_size = batch_size;
+        bt.pending.clear();
+
+        return info.This();  // Return this for chaining
+    }
+
 Napi::Value TransformByName(const Napi::CallbackInfo &info) {
     Napi::Env env = info.Env();
 
@@ -1034,6 +1471,18 @@ Napi::Value TransformByName(const Napi::CallbackInfo &info) {
             type = TRANSFORM_TO_FLOAT;
         } else if (transform_type == "hash_sha256" || transform_type == "sha256") {
             type = TRANSFORM_HASH_SHA256;
+        } else if (transform_type == "hash_md5" || transform_type == "md5") {
+            type = TRANSFORM_HASH_MD5;
+        } else if (transform_type == "hash_xxh3" || transform_type == "xxh3") {
+            type = TRANSFORM_HASH_XXH3;
+        } else if (transform_type == "encrypt_aes256" || transform_type == "encrypt") {
+            type = TRANSFORM_ENCRYPT_AES256;
+        } else if (transform_type == "decrypt_aes256" || transform_type == "decrypt") {
+            type = TRANSFORM_DECRYPT_AES256;
+        } else if (transform_type == "encrypt_aes256_ctr") {
+            type = TRANSFORM_ENCRYPT_AES256_CTR;
+        } else if (transform_type == "decrypt_aes256_ctr") {
+            type = TRANSFORM_DECRYPT_AES256_CTR;
         } else if (transform_type == "base64_encode" || transform_type == "base64") {
             type = TRANSFORM_BASE64_ENCODE;
         } else {
@@ -1207,6 +1656,7 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
         for (size_t i = 0; i < rc_->pipeline->header_count; i++) {
             if (strcmp(rc_->pipeline->header_fields[i], field_name.c_str()) == 0) {
                 rc_->js_transforms.erase(i);
+                rc_->js_batch_transforms.erase(i);
                 break;
             }
         }
@@ -1218,6 +1668,30 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
     return info.This();
 }
 
+    // Set the row number the next parse (or the current write() stream)
+    // continues from; decryption must number rows like encryption did
+    Napi::Value SetRow(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+
+        if (is_destroyed_) {
+            throw Napi::Error::New(env, "Parser has been destroyed");
+        }
+
+        if (info.Length() != 1 || !info[0].IsNumber()) {
+            throw Napi::TypeError::New(env, "Expected row number");
+        }
+
+        double row = info[0].As<Napi::Number>().DoubleValue();
+        if (!(row >= 0) || row > 9007199254740991.0 || row != (double)(uint64_t)row) {
+            throw Napi::RangeError::New(env, "Row number must be a non-negative integer");
+        }
+
+        rc_->next_row = (uint64_t)row;
+        if (rc_->pipeline) cisv_transform_pipeline_set_row(rc_->pipeline, rc_->next_row);
+
+        return info.This();
+    }
+
     Napi::Value RemoveTransform(const Napi::CallbackInfo &info) {
         Napi::Env env = info.Env();
 
@@ -1233,6 +1707,7 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
 
         // Remove from JavaScript transforms
         rc_->js_transforms.erase(field_index);
+        rc_->js_batch_transforms.erase(field_index);
 
         // TODO: Implement removal of C transforms in cisv_transformer.c
         // For now, this only removes JS transforms
@@ -1253,9 +1728,14 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
             }
         }
         rc_->js_transforms.clear();
+        for (auto &pair : rc_->js_batch_transforms) {
+            pair.second.fn.Reset();
+        }
+        rc_->js_batch_transforms.clear();
 
         // Clear C transforms - destroy and DON'T recreate pipeline yet
         if (rc_->pipeline) {
+            rc_->next_row = rc_->pipeline->row;
             cisv_transform_pipeline_destroy(rc_->pipeline);
             rc_->pipeline = nullptr;  // Will be recreated lazily when needed
         }
@@ -1265,45 +1745,12 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
 
     // Async file parsing (returns a Promise)
     Napi::Value ParseAsync(const Napi::CallbackInfo &info) {
-        Napi::Env env = info.Env();
+        return queueParse(info, false);
+    }
 
-        if (is_destroyed_) {
-            throw Napi::Error::New(env, "Parser has been destroyed");
-        }
-
-        if (info.Length() != 1 || !info[0].IsString()) {
-            throw Napi::TypeError::New(env, "Expected file path string");
-        }
-
-        std::string path = info[0].As<Napi::String>();
-
-        auto deferred = Napi::Promise::Deferred::New(env);
-
-        // Preserve behavior for transform-enabled parsers (native + JS transforms)
-        // until async transform execution is implemented.
-        bool has_c_transforms = rc_ && rc_->pipeline && rc_->pipeline->count > 0;
-        bool has_js_transforms = rc_ && !rc_->js_transforms.empty();
-        if (has_c_transforms || has_js_transforms) {
-            try {
-                Napi::Value result = ParseSync(info);
-                deferred.Resolve(result);
-            } catch (const Napi::Error &e) {
-                deferred.Reject(e.Value());
-            }
-            return deferred.Promise();
-        }
-
-        // Use batch parser in a worker thread to avoid blocking the event loop.
-        cisv_config worker_config = config_;
-        worker_config.field_cb = nullptr;
-        worker_config.row_cb = nullptr;
-        worker_config.error_cb = nullptr;
-        worker_config.user = nullptr;
-
-        auto *worker = new ParseFileWorker(env, path, worker_config, deferred);
-        worker->Queue();
-
-        return deferred.Promise();
+    // Async file parsing into a CisvRowView (returns a Promise)
+    Napi::Value ParseViewAsync(const Napi::CallbackInfo &info) {
+        return queueParse(info, true);
     }
 
     // Get information about registered transforms
@@ -1321,7 +1768,7 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
         result.Set("cTransformCount", Napi::Number::New(env, c_transform_count));
 
         // Count JS transforms
-        size_t js_transform_count = rc_ ? rc_->js_transforms.size() : 0;
+        size_t js_transform_count = rc_ ? rc_->js_transforms.size() + rc_->js_batch_transforms.size() : 0;
         result.Set("jsTransformCount", Napi::Number::New(env, js_transform_count));
 
         // List field indices with transforms
@@ -1333,6 +1780,9 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
             for (const auto& pair : rc_->js_transforms) {
                 fields[idx++] = Napi::Number::New(env, pair.first);
             }
+            for (const auto& pair : rc_->js_batch_transforms) {
+                fields[idx++] = Napi::Number::New(env, pair.first);
+            }
         }
 
         result.Set("fieldIndices", fields);
@@ -1468,6 +1918,7 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
 
         // Use current parser configuration for the iterator
         iterator_ = cisv_iterator_open(path.c_str(), &config_);
+        iter_interner_ = StringInterner();
         if (!iterator_) {
             throw Napi::Error::New(env, "Failed to open file for iteration: " + path);
         }
@@ -1512,6 +1963,64 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
         return Napi::Value(env, row);
     }
 
+    /**
+     * Fetch up to maxRows rows (default 1024) in one native call.
+     * @returns Array of rows, or null if at end of file
+     */
+    Napi::Value FetchRows(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+
+        if (is_destroyed_) {
+            throw Napi::Error::New(env, "Parser has been destroyed");
+        }
+
+        if (!iterator_) {
+            throw Napi::Error::New(env, "No iterator open. Call openIterator() first.");
+        }
+
+        size_t max_rows = 0;
+        if (info.Length() > 0 && !info[0].IsUndefined()) {
+            if (!info[0].IsNumber()) {
+                throw Napi::TypeError::New(env, "maxRows must be a number");
+            }
+            double n = info[0].As<Napi::Number>().DoubleValue();
+            if (n < 1) {
+                throw Napi::RangeError::New(env, "maxRows must be at least 1");
+            }
+            max_rows = (size_t)n;
+        }
+
+        cisv_iterator_batch_t batch;
+        int result = cisv_iterator_next_batch(iterator_, max_rows, &batch);
+
+        if (result == CISV_ITER_EOF) {
+            return env.Null();
+        }
+        if (result == CISV_ITER_ERROR) {
+            throw Napi::Error::New(env, "Error reading CSV row");
+        }
+
+        // Columns found not to repeat stay off for the rest of the file
+        iter_interner_.Clear();
+        napi_value rows;
+        napi_create_array_with_length(env, batch.row_count, &rows);
+        for (size_t r = 0; r < batch.row_count; r++) {
+            size_t first = batch.row_offsets[r];
+            size_t count = batch.row_offsets[r + 1] - first;
+
+            napi_value row;
+            napi_create_array_with_length(env, count, &row);
+            for (size_t i = 0; i < count; i++) {
+                napi_set_element(env, row, i,
+                                 iter_interner_.Get(env, i, batch.fields[first + i],
+                                              batch.lengths[first + i]));
+            }
+            napi_set_element(env, rows, r, row);
+        }
+
+        return Napi::Value(env, rows);
+    }
+
     /**
      * Close the iterator and release resources.
      * @returns this for chaining
@@ -1532,6 +2041,136 @@ Napi::Value RemoveTransformByName(const Napi::CallbackInfo &info) {
     }
 
 private:
+    // Parse on a worker thread; view selects a CisvRowView result
+    Napi::Value queueParse(const Napi::CallbackInfo &info, bool view) {
+        Napi::Env env = info.Env();
+
+        if (is_destroyed_) {
+            throw Napi::Error::New(env, "Parser has been destroyed");
+        }
+
+        if (info.Length() != 1 || !info[0].IsString()) {
+            throw Napi::TypeError::New(env, "Expected file path string");
+        }
+
+        std::string path = info[0].As<Napi::String>();
+
+        auto deferred = Napi::Promise::Deferred::New(env);
+
+        // Preserve behavior for transform-enabled parsers (native + JS transforms)
+        // until async transform execution is implemented.
+        if (hasTransforms()) {
+            try {
+                Napi::Value result = view ? ParseViewSync(info) : ParseSync(info);
+                deferred.Resolve(result);
+            } catch (const Napi::Error &e) {
+                deferred.Reject(e.Value());
+            }
+            return deferred.Promise();
+        }
+
+        // Use batch parser in a worker thread to avoid blocking the event loop.
+        cisv_config worker_config = config_;
+        worker_config.field_cb = nullptr;
+        worker_config.row_cb = nullptr;
+        worker_config.error_cb = nullptr;
+        worker_config.user = nullptr;
+
+        auto *worker = new ParseFileWorker(env, path, worker_config, view, deferred);
+        worker->Queue();
+
+        return deferred.Promise();
+    }
+
+    // Parse the file named by info[0] into batch_result_ or rc_->rows
+    void parseFile(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+
+        if (is_destroyed_) {
+            throw Napi::Error::New(env, "Parser has been destroyed");
+        }
+
+        if (info.Length() != 1 || !info[0].IsString()) {
+            throw Napi::TypeError::New(env, "Expected file path string");
+        }
+
+        std::string path = info[0].As<Napi::String>();
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        resetRowState();
+
+        int result = 0;
+        if (!hasTransforms()) {
+            cisv_result_t *batch = cisv_parse_file_batch(path.c_str(), &config_);
+            if (!batch) {
+                throw Napi::Error::New(env, "parse error: " + std::string(strerror(errno)));
+            }
+            if (batch->error_code != 0) {
+                std::string msg = batch->error_message[0] ? batch->error_message : "parse error";
+                cisv_result_free(batch);
+                throw Napi::Error::New(env, msg);
+            }
+            clearBatchResult();
+            batch_result_ = batch;
+        } else {
+            // Set environment for JS transforms
+            rc_->env = env;
+            result = cisv_parser_parse_file(parser_, path.c_str());
+            // Clear the environment reference after parsing
+            rc_->env = nullptr;
+            if (result < 0) {
+                throw Napi::Error::New(env, "parse error: " + std::to_string(result));
+            }
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        parse_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    }
+
+    // Parse the CSV string in info[0] into batch_result_ or rc_->rows
+    void parseString(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+
+        if (is_destroyed_) {
+            throw Napi::Error::New(env, "Parser has been destroyed");
+        }
+
+        if (info.Length() != 1 || !info[0].IsString()) {
+            throw Napi::TypeError::New(env, "Expected CSV string");
+        }
+
+        std::string content = info[0].As<Napi::String>();
+
+        resetRowState();
+
+        if (!hasTransforms()) {
+            cisv_result_t *batch = cisv_parse_string_batch(content.c_str(), content.length(), &config_);
+            if (!batch) {
+                throw Napi::Error::New(env, "parse error: " + std::string(strerror(errno)));
+            }
+            if (batch->error_code != 0) {
+                std::string msg = batch->error_message[0] ? batch->error_message : "parse error";
+                cisv_result_free(batch);
+                throw Napi::Error::New(env, msg);
+            }
+            clearBatchResult();
+            batch_result_ = batch;
+        } else {
+            // Set environment for JS transforms
+            rc_->env = env;
+
+            // Write the string content as chunks
+            cisv_parser_write(parser_, (const uint8_t*)content.c_str(), content.length());
+            cisv_parser_end(parser_);
+
+            // Clear the environment reference after parsing
+            rc_->env = nullptr;
+        }
+
+        total_bytes_ = content.length();
+    }
+
     void clearBatchResult() {
         if (batch_result_) {
             cisv_result_free(batch_result_);
@@ -1541,7 +2180,7 @@ private:
 
     bool hasTransforms() const {
         bool has_c_transforms = rc_ && rc_->pipeline && rc_->pipeline->count > 0;
-        bool has_js_transforms = rc_ && !rc_->js_transforms.empty();
+        bool has_js_transforms = rc_ && rc_->hasJsTransforms();
         return has_c_transforms || has_js_transforms;
     }
 
@@ -1553,6 +2192,7 @@ private:
         rc_->rows.clear();
         rc_->current.clear();
         rc_->current_field_index = 0;
+        rc_->dropPendingBatches();
     }
 
     void flushPendingStreamToParser() {
@@ -1566,23 +2206,27 @@ private:
         pending_stream_.clear();
     }
 
-    void loadRowsFromBatch(const cisv_result_t *result) {
-        if (!rc_ || !result) return;
-        rc_->rows.clear();
-        rc_->rows.reserve(result->row_count);
-
-        for (size_t i = 0; i < result->row_count; i++) {
-            const cisv_row_t *row = &result->rows[i];
-            std::vector<std::string> out_row;
-            out_row.reserve(row->field_count);
-            for (size_t j = 0; j < row->field_count; j++) {
-                out_row.emplace_back(row->fields[j], row->field_lengths[j]);
-            }
-            rc_->rows.emplace_back(std::move(out_row));
+    // Move the current rows into a CisvRowView; the parser is left empty
+    Napi::Value takeRowView(Napi::Env env) {
+        static const std::vector<std::vector<std::string>> no_rows;
+        RowViewData packed;
+        bool ok;
+        if (batch_result_) {
+            ok = PackBatchResult(batch_result_, &packed);
+            batch_result_ = nullptr;
+        } else {
+            if (rc_ && !rc_->flushBatchTransforms(env, true)) return env.Undefined();
+            ok = PackRows(rc_ ? rc_->rows : no_rows, &packed);
+            if (rc_) rc_->rows.clear();
+        }
+        if (!ok) {
+            throw Napi::Error::New(env, "out of memory");
         }
+        return CisvRowView::New(env, packed);
     }
 
     Napi::Value drainRows(Napi::Env env) {
+        StringInterner interner;
         if (batch_result_) {
             napi_value rows;
             napi_create_array_with_length(env, batch_result_->row_count, &rows);
@@ -1591,7 +2235,7 @@ private:
                 napi_value row;
                 napi_create_array_with_length(env, src_row->field_count, &row);
                 for (size_t j = 0; j < src_row->field_count; ++j) {
-                    napi_set_element(env, row, j, SafeNewStringValue(env, src_row->fields[j], src_row->field_lengths[j]));
+                    napi_set_element(env, row, j, interner.Get(env, j, src_row->fields[j], src_row->field_lengths[j]));
                 }
                 napi_set_element(env, rows, i, row);
             }
@@ -1602,6 +2246,10 @@ private:
             return Napi::Array::New(env, 0);
         }
 
+        // Rows still waiting on a partial batch get their transform now;
+        // a batch function that threw leaves its exception to return to JS
+        if (!rc_->flushBatchTransforms(env, true)) return env.Undefined();
+
         napi_value rows;
         napi_create_array_with_length(env, rc_->rows.size(), &rows);
 
@@ -1611,7 +2259,7 @@ private:
             for (size_t j = 0; j < rc_->rows[i].size(); ++j) {
                 // SECURITY: Use safe string creation to handle invalid UTF-8 in CSV data
                 const std::string& field = rc_->rows[i][j];
-                napi_set_element(env, row, j, SafeNewStringValue(env, field.c_str(), field.length()));
+                napi_set_element(env, row, j, interner.Get(env, j, field.c_str(), field.length()));
             }
             napi_set_element(env, rows, i, row);
         }
@@ -1629,15 +2277,426 @@ private:
     double parse_time_;
     bool is_destroyed_;
     cisv_iterator_t *iterator_;  // For row-by-row iteration
+    StringInterner iter_interner_;  // fetchRows() values of the open iterator
     cisv_result_t *batch_result_;
     std::string pending_stream_;
     bool stream_buffering_active_;
     static constexpr size_t kStreamBufferLimitBytes = 8 * 1024 * 1024;
 };
 
+// =============================================================================
+// Streaming parser: CSV bytes are queued by write() and parsed on a native
+// thread; row batches come back through a thread-safe function whose queue
+// holds at most highWaterMark batches. A full queue or a pause() from a
+// readable side that is over its highWaterMark stalls the parse thread, and
+// once queued input passes maxBufferedBytes write() returns false until a
+// 'drain' event, so memory stays bounded whatever the input size. The first
+// parse error (or a failed allocation) ends the stream with an 'error' event.
+// The thread-safe function only holds the event loop open while input is
+// queued or being parsed, and reaches onEvent through the wrapper object, so
+// an idle stream neither keeps the process alive nor pins the wrapper.
+// =============================================================================
+
+struct StreamMessage {
+    enum Kind { Rows, Drain, End, Error, Idle } kind;
+    std::vector<std::vector<std::string>> rows;
+    RowViewData packed;                  // Rows packed for a CisvRowView (views mode)
+    std::string error;                   // Error message (Error)
+
+    explicit StreamMessage(Kind k) : kind(k) {}
+};
+
+struct StreamState;
+class CisvStreamParser;
+
+static void StreamCallJs(Napi::Env env, Napi::Function callback,
+                         std::shared_ptr<StreamState> *context, StreamMessage *msg);
+
+using StreamTsfn = Napi::TypedThreadSafeFunction<
+    std::shared_ptr<StreamState>, StreamMessage, StreamCallJs>;
+
+struct StreamState {
+    cisv_parser *parser = nullptr;
+    std::thread thread;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::string> queue;       // Input chunks not yet parsed
+    size_t queued_bytes = 0;
+    size_t unparsed = 0;                 // Chunks written whose parse has not finished
+    bool ended = false;                  // end() called
+    bool blocked = false;                // write() returned false, 'drain' owed
+    bool paused = false;                 // pause() called, no rows until resume()
+    bool released = false;               // Parse thread released tsfn; no Ref() after
+    std::atomic<bool> aborted{false};    // destroy() called or wrapper collected
+    StringInterner interner;             // JS thread only: row batch values
+    CisvStreamParser *owner = nullptr;   // JS thread only: valid until aborted
+
+    size_t max_bytes = 0;                // maxBufferedBytes
+    size_t batch_size = 0;               // Rows per batch
+    bool views = false;                  // Deliver CisvRowView batches
+    bool skip_errors = false;            // skipLinesWithError: errors do not end the stream
+
+    StreamTsfn tsfn;                     // Ref()/Unref() on the JS thread under mutex
+
+    // Parse thread only
+    bool failed = false;                 // An 'error' was sent; stop parsing
+    std::unique_ptr<StreamMessage> batch;
+    std::vector<std::string> current;
+
+    ~StreamState() {
+        if (parser) cisv_parser_destroy(parser);
+    }
+};
+
+class CisvStreamParser final : public Napi::ObjectWrap<CisvStreamParser> {
+public:
+    static void Init(Napi::Env env, Napi::Object exports) {
+        Napi::Function func = DefineClass(env, "cisvStreamParser", {
+            InstanceMethod("write", &CisvStreamParser::Write),
+            InstanceMethod("end", &CisvStreamParser::End),
+            InstanceMethod("pause", &CisvStreamParser::Pause),
+            InstanceMethod("resume", &CisvStreamParser::Resume),
+            InstanceMethod("destroy", &CisvStreamParser::Destroy)
+        });
+        exports.Set("cisvStreamParser", func);
+    }
+
+    // new cisvStreamParser(config, onEvent, { batchSize, highWaterMark, maxBufferedBytes, rowViews })
+    // onEvent(type, arg?) receives 'rows' (with the batch), 'drain', 'end'
+    // and 'error' (with the message)
+    CisvStreamParser(const Napi::CallbackInfo &info) : Napi::ObjectWrap<CisvStreamParser>(info) {
+        Napi::Env env = info.Env();
+
+        if (info.Length() < 2 || !info[1].IsFunction()) {
+            throw Napi::TypeError::New(env, "Expected (config, onEvent[, options])");
+        }
+
+        cisv_config config;
+        cisv_config_init(&config);
+        config.max_row_size = 0;
+        if (info[0].IsObject()) {
+            CisvParser::ApplyConfigFromObject(config, info[0].As<Napi::Object>());
+        }
+
+        size_t high_water_mark = 16;
+        state_ = std::make_shared<StreamState>();
+        state_->batch_size = 1024;
+        state_->max_bytes = 8 * 1024 * 1024;
+        if (info.Length() > 2 && info[2].IsObject()) {
+            Napi::Object options = info[2].As<Napi::Object>();
+            state_->batch_size = PositiveOption(options, "batchSize", state_->batch_size);
+            high_water_mark = PositiveOption(options, "highWaterMark", high_water_mark);
+            state_->max_bytes = PositiveOption(options, "maxBufferedBytes", state_->max_bytes);
+            if (options.Has("rowViews")) {
+                state_->views = options.Get("rowViews").ToBoolean();
+            }
+        }
+
+        config.field_cb = FieldCallback;
+        config.row_cb = RowCallback;
+        config.error_cb = ErrorCallback;
+        config.user = state_.get();
+        state_->skip_errors = config.skip_lines_with_error;
+        state_->parser = cisv_parser_create_with_config(&config);
+        if (!state_->parser) {
+            throw Napi::Error::New(env, "Failed to create parser");
+        }
+
+        // onEvent hangs off the wrapper rather than the thread-safe function,
+        // so a stream dropped before end() can still be collected
+        Value().DefineProperty(Napi::PropertyDescriptor::Value(
+            kOnEventKey, info[1].As<Napi::Function>(), napi_default));
+        state_->owner = this;
+
+        // The thread-safe function owns a second reference so the state
+        // outlives this wrapper until the parse thread has been joined
+        state_->tsfn = StreamTsfn::New(env, "cisvStreamParser",
+                                high_water_mark, 1, new std::shared_ptr<StreamState>(state_),
+                                [](Napi::Env, void *, std::shared_ptr<StreamState> *context) {
+                                    StreamState *state = context->get();
+                                    {
+                                        // Environment teardown finalizes an unreleased
+                                        // stream: wake the idle thread so it can exit
+                                        std::lock_guard<std::mutex> lock(state->mutex);
+                                        state->aborted = true;
+                                        state->cv.notify_all();
+                                    }
+                                    if (state->thread.joinable()) state->thread.join();
+                                    delete context;
+                                });
+        // Nothing is queued yet; write() and end() hold the loop open
+        state_->tsfn.Unref(env);
+        state_->thread = std::thread(Run, state_.get());
+    }
+
+    ~CisvStreamParser() {
+        Abort();
+    }
+
+    // Empty once the wrapper has been collected, even if its finalizer
+    // (which aborts the stream) has not run yet
+    Napi::Function OnEvent() {
+        Napi::Object self = Value();
+        if (self.IsEmpty()) return Napi::Function();
+        return self.Get(kOnEventKey).As<Napi::Function>();
+    }
+
+private:
+    static constexpr const char *kOnEventKey = "_onEvent";
+
+    static size_t PositiveOption(Napi::Object options, const char *name, size_t fallback) {
+        if (!options.Has(name)) return fallback;
+        Napi::Value val = options.Get(name);
+        if (!val.IsNumber()) return fallback;
+        double n = val.As<Napi::Number>().DoubleValue();
+        return n >= 1 ? static_cast<size_t>(n) : fallback;
+    }
+
+    static void FieldCallback(void *user, const char *data, size_t len) {
+        auto *state = static_cast<StreamState *>(user);
+        if (!state->failed) state->current.emplace_back(data, len);
+    }
+
+    // Full batches go out from inside the parse, so a large chunk never
+    // accumulates more than batchSize rows
+    static void RowCallback(void *user) {
+        auto *state = static_cast<StreamState *>(user);
+        if (state->failed) return;
+        if (!state->batch) {
+            state->batch.reset(new StreamMessage(StreamMessage::Rows));
+            state->batch->rows.reserve(state->batch_size);
+        }
+        state->batch->rows.emplace_back(std::move(state->current));
+        state->current.clear();
+        if (state->batch->rows.size() >= state->batch_size) {
+            Send(state, std::move(state->batch));
+        }
+    }
+
+    // Rows already parsed go out first, then the error; nothing follows it
+    static void ErrorCallback(void *user, int line, const char *msg) {
+        auto *state = static_cast<StreamState *>(user);
+        if (state->failed || state->skip_errors) return;
+        if (state->batch) Send(state, std::move(state->batch));
+        Fail(state, "Parse error at line " + std::to_string(line) + ": " +
+                    (msg ? msg : "unknown error"));
+    }
+
+    static void Fail(StreamState *state, std::string error) {
+        if (state->failed) return;
+        state->failed = true;
+        state->current.clear();
+        state->batch.reset();
+        std::unique_ptr<StreamMessage> msg(new StreamMessage(StreamMessage::Error));
+        msg->error = std::move(error);
+        Send(state, std::move(msg));
+    }
+
+    // Parse thread: hand a message to the JS thread, waiting while its queue
+    // is full or, for rows, while the readable side is paused
+    static void Send(StreamState *state, std::unique_ptr<StreamMessage> msg) {
+        if (state->aborted) return;
+        if (msg->kind == StreamMessage::Rows) {
+            if (state->failed) return;
+            if (state->views) {
+                if (!PackRows(msg->rows, &msg->packed)) {
+                    Fail(state, "out of memory packing a row batch");
+                    return;
+                }
+                msg->rows.clear();
+            }
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->cv.wait(lock, [state] { return state->aborted || !state->paused; });
+            if (state->aborted) return;
+        }
+        if (state->tsfn.BlockingCall(msg.get()) == napi_ok) {
+            msg.release();
+        }
+    }
+
+    static void Run(StreamState *state) {
+        for (;;) {
+            std::string chunk;
+            bool drained = false;
+            {
+                std::unique_lock<std::mutex> lock(state->mutex);
+                state->cv.wait(lock, [state] {
+                    return state->aborted || state->ended || !state->queue.empty();
+                });
+                if (state->aborted || state->queue.empty()) break;
+                chunk = std::move(state->queue.front());
+                state->queue.pop_front();
+                state->queued_bytes -= chunk.size();
+                if (state->blocked && state->queued_bytes < state->max_bytes) {
+                    state->blocked = false;
+                    drained = true;
+                }
+            }
+            if (drained) {
+                Send(state, std::unique_ptr<StreamMessage>(new StreamMessage(StreamMessage::Drain)));
+            }
+            int rc = cisv_parser_write(state->parser,
+                                       reinterpret_cast<const uint8_t *>(chunk.data()), chunk.size());
+            if (rc < 0 && !state->failed) {
+                Fail(state, "parse error: " + std::string(strerror(-rc)));
+            }
+            if (state->failed) break;
+
+            bool idle;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                idle = --state->unparsed == 0 && !state->ended;
+            }
+            if (idle) Send(state, std::unique_ptr<StreamMessage>(new StreamMessage(StreamMessage::Idle)));
+        }
+
+        if (!state->aborted && !state->failed) {
+            cisv_parser_end(state->parser);
+            if (state->batch) Send(state, std::move(state->batch));
+            if (!state->failed) {
+                Send(state, std::unique_ptr<StreamMessage>(new StreamMessage(StreamMessage::End)));
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->released = true;
+        }
+        state->tsfn.Release();
+    }
+
+    // write(chunk): false once maxBufferedBytes are queued; wait for 'drain'
+    Napi::Value Write(const Napi::CallbackInfo &info) {
+        Napi::Env env = info.Env();
+
+        if (info.Length() != 1) {
+            throw Napi::TypeError::New(env, "Expected one argument");
+        }
+
+        std::string chunk;
+        if (info[0].IsBuffer()) {
+            auto buf = info[0].As<Napi::Buffer<uint8_t>>();
+            chunk.assign(reinterpret_cast<const char *>(buf.Data()), buf.Length());
+        } else if (info[0].IsString()) {
+            chunk = info[0].As<Napi::String>();
+        } else {
+            throw Napi::TypeError::New(env, "Expected Buffer or String");
+        }
+
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (state_->ended || state_->aborted) {
+            throw Napi::Error::New(env, "write after end");
+        }
+        state_->queued_bytes += chunk.size();
+        state_->queue.emplace_back(std::move(chunk));
+        state_->unparsed++;
+        if (!state_->released) state_->tsfn.Ref(env);
+        state_->cv.notify_one();
+        if (state_->queued_bytes >= state_->max_bytes) {
+            state_->blocked = true;
+            return Napi::Boolean::New(env, false);
+        }
+        return Napi::Boolean::New(env, true);
+    }
+
+    // end(): parse what is queued, flush the last batch, then emit 'end'
+    void End(const Napi::CallbackInfo &info) {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (!state_->released) state_->tsfn.Ref(info.Env());
+        state_->ended = true;
+        state_->cv.notify_one();
+    }
+
+    // pause(): hold further row batches until resume()
+    void Pause(const Napi::CallbackInfo &info) {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->paused = true;
+    }
+
+    void Resume(const Napi::CallbackInfo &info) {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->paused = false;
+        state_->cv.notify_one();
+    }
+
+    // destroy(): drop queued input and stop without emitting further events
+    void Destroy(const Napi::CallbackInfo &info) {
+        Abort();
+    }
+
+    void Abort() {
+        if (!state_) return;
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->aborted = true;
+        state_->queue.clear();
+        state_->queued_bytes = 0;
+        state_->cv.notify_one();
+    }
+
+    std::shared_ptr<StreamState> state_;
+};
+
+// The wrapper's destructor aborts the stream, so an owner that is not
+// aborted is still allocated
+static void StreamCallJs(Napi::Env env, Napi::Function,
+                         std::shared_ptr<StreamState> *context, StreamMessage *raw) {
+    std::unique_ptr<StreamMessage> msg(raw);
+    StreamState *state = context->get();
+    if (env == nullptr || state->aborted) return;
+
+    if (msg->kind == StreamMessage::Idle) {
+        // Every written chunk is parsed and its rows delivered: stop holding
+        // the event loop open until the next write() or end()
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->unparsed == 0 && !state->ended && !state->released) state->tsfn.Unref(env);
+        return;
+    }
+
+    Napi::Function callback = state->owner->OnEvent();
+    if (callback.IsEmpty()) return;
+    switch (msg->kind) {
+    case StreamMessage::Rows: {
+        Napi::Value rows;
+        if (state->views) {
+            rows = CisvRowView::New(env, msg->packed);
+        } else {
+            StringInterner &interner = state->interner;
+            interner.Clear();
+            napi_value out;
+            napi_create_array_with_length(env, msg->rows.size(), &out);
+            for (size_t i = 0; i < msg->rows.size(); i++) {
+                napi_value row;
+                napi_create_array_with_length(env, msg->rows[i].size(), &row);
+                for (size_t j = 0; j < msg->rows[i].size(); j++) {
+                    const std::string &field = msg->rows[i][j];
+                    napi_set_element(env, row, j, interner.Get(env, j, field.data(), field.size()));
+                }
+                napi_set_element(env, out, i, row);
+            }
+            rows = Napi::Value(env, out);
+        }
+        callback.Call({Napi::String::New(env, "rows"), rows});
+        break;
+    }
+    case StreamMessage::Drain:
+        callback.Call({Napi::String::New(env, "drain")});
+        break;
+    case StreamMessage::End:
+        callback.Call({Napi::String::New(env, "end")});
+        break;
+    case StreamMessage::Error:
+        callback.Call({Napi::String::New(env, "error"), Napi::String::New(env, msg->error)});
+        break;
+    case StreamMessage::Idle:
+        break;
+    }
+}
+
 // Initialize all exports
 Napi::Object InitAll(Napi::Env env, Napi::Object exports) {
     CisvParser::Init(env, exports);
+    CisvRowView::Init(env);
+    CisvStreamParser::Init(env, exports);
 
     // Add version info
     exports.Set("version", Napi::String::New(env, "1.1.0"));
@@ -1650,6 +2709,12 @@ Napi::Object InitAll(Napi::Env env, Napi::Object exports) {
     transformTypes.Set("TO_INT", Napi::String::New(env, "to_int"));
     transformTypes.Set("TO_FLOAT", Napi::String::New(env, "to_float"));
     transformTypes.Set("HASH_SHA256", Napi::String::New(env, "hash_sha256"));
+    transformTypes.Set("HASH_MD5", Napi::String::New(env, "hash_md5"));
+    transformTypes.Set("HASH_XXH3", Napi::String::New(env, "hash_xxh3"));
+    transformTypes.Set("ENCRYPT_AES256", Napi::String::New(env, "encrypt_aes256"));
+    transformTypes.Set("DECRYPT_AES256", Napi::String::New(env, "decrypt_aes256"));
+    transformTypes.Set("ENCRYPT_AES256_CTR", Napi::String::New(env, "encrypt_aes256_ctr"));
+    transformTypes.Set("DECRYPT_AES256_CTR", Napi::String::New(env, "decrypt_aes256_ctr"));
     transformTypes.Set("BASE64_ENCODE", Napi::String::New(env, "base64_encode"));
     exports.Set("TransformType", transformTypes);
 
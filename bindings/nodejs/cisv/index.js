@@ -1,4 +1,9 @@
 const path = require('path');
 const addon = require('node-gyp-build')(path.join(__dirname, '..'));
+const { defineParseStream } = require('./stream');
+
+if (!addon.CisvParseStream) {
+  addon.CisvParseStream = defineParseStream(addon.cisvStreamParser);
+}
 
 module.exports = addon;
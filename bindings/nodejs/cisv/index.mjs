@@ -7,6 +7,12 @@ const require = createRequire(import.meta.url);
 
 const gyp = require('node-gyp-build');
 const addon = gyp(path.join(__dirname, '..'));
+const { defineParseStream } = require('./stream.js');
+
+if (!addon.CisvParseStream) {
+  addon.CisvParseStream = defineParseStream(addon.cisvStreamParser);
+}
 
 export const cisvParser = addon.cisvParser;
+export const CisvParseStream = addon.CisvParseStream;
 export default addon;
@@ -0,0 +1,72 @@
+const { Transform } = require('stream');
+
+// Transform stream over the native cisvStreamParser: CSV bytes in, row
+// batches out (arrays of rows, or CisvRowView objects with rowViews: true).
+// Parsing runs on a native thread. A chunk's callback is held while the
+// native input queue is over maxBufferedBytes, and the native side stops
+// parsing while highWaterMark batches wait for the JS thread or the readable
+// buffer is full. Parse errors destroy the stream with an Error.
+function defineParseStream(cisvStreamParser) {
+  return class CisvParseStream extends Transform {
+    constructor(options = {}) {
+      const {
+        batchSize,
+        highWaterMark = 16,
+        maxBufferedBytes,
+        rowViews = false,
+        ...config
+      } = options;
+      super({ readableObjectMode: true, readableHighWaterMark: highWaterMark });
+
+      this._pendingCallback = null;
+      this._flushCallback = null;
+      this._native = new cisvStreamParser(
+        config,
+        (event, arg) => this._onNativeEvent(event, arg),
+        { batchSize, highWaterMark, maxBufferedBytes, rowViews }
+      );
+    }
+
+    _transform(chunk, encoding, callback) {
+      if (typeof chunk === 'string') chunk = Buffer.from(chunk, encoding);
+      if (this._native.write(chunk)) {
+        callback();
+      } else {
+        this._pendingCallback = callback;
+      }
+    }
+
+    _read(size) {
+      this._native.resume();
+      super._read(size);
+    }
+
+    _flush(callback) {
+      this._flushCallback = callback;
+      this._native.end();
+    }
+
+    _destroy(err, callback) {
+      this._native.destroy();
+      callback(err);
+    }
+
+    _onNativeEvent(event, arg) {
+      if (event === 'rows') {
+        if (!this.push(arg)) this._native.pause();
+      } else if (event === 'error') {
+        this.destroy(new Error(arg));
+      } else if (event === 'drain') {
+        const callback = this._pendingCallback;
+        this._pendingCallback = null;
+        if (callback) callback();
+      } else if (event === 'end') {
+        const callback = this._flushCallback;
+        this._flushCallback = null;
+        if (callback) callback();
+      }
+    }
+  };
+}
+
+module.exports = { defineParseStream };
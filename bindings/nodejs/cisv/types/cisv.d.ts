@@ -9,6 +9,12 @@ declare module 'cisv' {
     TO_INT = 'to_int',
     TO_FLOAT = 'to_float',
     HASH_SHA256 = 'hash_sha256',
+    HASH_MD5 = 'hash_md5',
+    HASH_XXH3 = 'hash_xxh3',
+    ENCRYPT_AES256 = 'encrypt_aes256',
+    DECRYPT_AES256 = 'decrypt_aes256',
+    ENCRYPT_AES256_CTR = 'encrypt_aes256_ctr',
+    DECRYPT_AES256_CTR = 'decrypt_aes256_ctr',
     BASE64_ENCODE = 'base64_encode',
     CUSTOM = 'custom'
   }
@@ -51,6 +57,35 @@ declare module 'cisv' {
    */
   export type TransformFunction = (value: string, rowIndex: number, fieldIndex: number) => string;
 
+  /**
+   * Zero-copy parse result: field bytes behind an external ArrayBuffer,
+   * decoded to strings only when read
+   */
+  export interface CisvRowView {
+    readonly buffer: ArrayBuffer;
+    readonly offsets: Uint32Array | Float64Array;
+    readonly lengths: Uint32Array | Float64Array;
+    readonly rowStarts: Uint32Array | Float64Array;
+    readonly rowCount: number;
+    get(row: number, column: number): string | undefined;
+    row(row: number): string[] | undefined;
+    fieldCount(row: number): number;
+    toArray(): string[][];
+  }
+
+  /**
+   * Transform stream that parses on a native thread: CSV bytes in, batches
+   * of rows out (string[][], or CisvRowView with rowViews: true)
+   */
+  export class CisvParseStream extends import('stream').Transform {
+    constructor(options?: ParseOptions & {
+      batchSize?: number;
+      highWaterMark?: number;
+      maxBufferedBytes?: number;
+      rowViews?: boolean;
+    });
+  }
+
   /**
    * Main CSV parser class with transformation pipeline support
    */
@@ -78,6 +113,24 @@ declare module 'cisv' {
      */
     parseString(content: string): string[][];
 
+    /**
+     * Parse CSV file synchronously into a zero-copy row view
+     * @param path Path to CSV file
+     */
+    parseViewSync(path: string): CisvRowView;
+
+    /**
+     * Parse CSV file on a worker thread into a zero-copy row view
+     * @param path Path to CSV file
+     */
+    parseView(path: string): Promise<CisvRowView>;
+
+    /**
+     * Parse CSV string content into a zero-copy row view
+     * @param content CSV string content
+     */
+    parseStringView(content: string): CisvRowView;
+
     /**
      * Write chunk of CSV data (for streaming)
      * @param chunk Buffer containing CSV data
@@ -95,6 +148,11 @@ declare module 'cisv' {
      */
     getRows(): string[][];
 
+    /**
+     * Hand the parsed rows over as a zero-copy row view
+     */
+    getRowsView(): CisvRowView;
+
     /**
      * Clear all parsed rows
      */
@@ -113,6 +171,20 @@ declare module 'cisv' {
       context?: TransformContext
     ): this;
 
+    /**
+     * Add a batched transformation: called with up to batchSize values of
+     * one column at a time, returns the transformed values
+     * @param fieldIndex Index of the field to transform (-1 for all fields)
+     * @param transform Batch transform function
+     * @param batchSize Values per call (default 1024)
+     * @returns this for chaining
+     */
+    transformBatch(
+      fieldIndex: number,
+      transform: (values: string[], fieldIndex: number) => string[],
+      batchSize?: number
+    ): this;
+
     /**
      * Add multiple transformations at once
      * @param transforms Map of field indices to transform types/functions
@@ -133,6 +205,14 @@ declare module 'cisv' {
      */
     clearTransforms(): this;
 
+    /**
+     * Set the number of the next row (rows count from 0 across all parses);
+     * AES nonces are derived from it
+     * @param row Row number of the next row
+     * @returns this for chaining
+     */
+    setRow(row: number): this;
+
     /**
      * Apply transformations to existing data
      * @param data Array of rows to transform
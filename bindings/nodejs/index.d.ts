@@ -42,6 +42,41 @@ declare module 'cisv' {
    */
   export type ParsedRow = string[];
 
+  /**
+   * Zero-copy parse result. Field bytes stay in native memory behind an
+   * external ArrayBuffer; a field is decoded to a string only when read.
+   * Index arrays are Uint32Array, or Float64Array once the data or the
+   * field count outgrows 32 bits.
+   */
+  export interface CisvRowView {
+    /** Field bytes (UTF-8), addressed by offsets/lengths */
+    readonly buffer: ArrayBuffer;
+
+    /** Byte offset of each field in buffer */
+    readonly offsets: Uint32Array | Float64Array;
+
+    /** Byte length of each field */
+    readonly lengths: Uint32Array | Float64Array;
+
+    /** Index of each row's first field in offsets/lengths (rowCount + 1 entries) */
+    readonly rowStarts: Uint32Array | Float64Array;
+
+    /** Number of rows */
+    readonly rowCount: number;
+
+    /** Decode one field; undefined when row or column is out of range */
+    get(row: number, column: number): string | undefined;
+
+    /** Decode one row; undefined when out of range */
+    row(row: number): ParsedRow | undefined;
+
+    /** Number of fields in a row (0 when out of range) */
+    fieldCount(row: number): number;
+
+    /** Decode every row, same shape as parseSync() */
+    toArray(): ParsedRow[];
+  }
+
   /**
    * Statistics about the parsing operation
    */
@@ -81,6 +116,14 @@ declare module 'cisv' {
    */
   export type FieldTransformFn = (value: string, fieldIndex: number) => string;
 
+  /**
+   * Batched transform function signature
+   * @param values - Up to batchSize values of one column, in row order
+   * @param fieldIndex - Index of the field being transformed (-1 for all fields)
+   * @returns Transformed values at the same positions (non-strings keep the input)
+   */
+  export type BatchTransformFn = (values: string[], fieldIndex: number) => string[];
+
   /**
    * Transform function signature for row transforms
    * @param row - Array of field values
@@ -105,6 +148,16 @@ declare module 'cisv' {
     | 'float'
     | 'hash_sha256'
     | 'sha256'
+    | 'hash_md5'
+    | 'md5'
+    | 'hash_xxh3'
+    | 'xxh3'
+    | 'encrypt_aes256'
+    | 'encrypt'
+    | 'decrypt_aes256'
+    | 'decrypt'
+    | 'encrypt_aes256_ctr'
+    | 'decrypt_aes256_ctr'
     | 'base64_encode'
     | 'base64';
 
@@ -122,6 +175,34 @@ declare module 'cisv' {
     extra?: any;
   }
 
+  /**
+   * Options for CisvParseStream: parser configuration plus flow control
+   */
+  export interface CisvParseStreamOptions extends CisvConfig {
+    /** Rows per emitted batch (default: 1024) */
+    batchSize?: number;
+
+    /** Batches waiting for the JS thread or the reader before parsing pauses (default: 16) */
+    highWaterMark?: number;
+
+    /** Queued input bytes before writes are held back (default: 8 MiB) */
+    maxBufferedBytes?: number;
+
+    /** Emit CisvRowView batches instead of row arrays (default: false) */
+    rowViews?: boolean;
+  }
+
+  /**
+   * Transform stream that parses on a native thread. Write CSV bytes; read
+   * batches of rows (ParsedRow[], or CisvRowView with rowViews: true).
+   * Input and output are both bounded, so large uploads can be piped
+   * through without blocking the event loop. A parse error destroys the
+   * stream with an Error.
+   */
+  export class CisvParseStream extends import('stream').Transform {
+    constructor(options?: CisvParseStreamOptions);
+  }
+
   /**
    * High-performance CSV parser with SIMD optimization
    */
@@ -153,6 +234,28 @@ declare module 'cisv' {
      */
     parseString(csv: string): ParsedRow[];
 
+    /**
+     * Parse CSV file synchronously into a zero-copy row view
+     * @param path - Path to CSV file
+     * @returns Row view over the parsed data
+     */
+    parseViewSync(path: string): CisvRowView;
+
+    /**
+     * Parse CSV file on a worker thread into a zero-copy row view; the
+     * main thread only wraps the buffers
+     * @param path - Path to CSV file
+     * @returns Promise resolving to a row view
+     */
+    parseView(path: string): Promise<CisvRowView>;
+
+    /**
+     * Parse CSV string content into a zero-copy row view
+     * @param csv - CSV string content
+     * @returns Row view over the parsed data
+     */
+    parseStringView(csv: string): CisvRowView;
+
     /**
      * Write chunk of data for streaming parsing
      * @param chunk - Data chunk as Buffer or string
@@ -170,6 +273,13 @@ declare module 'cisv' {
      */
     getRows(): ParsedRow[];
 
+    /**
+     * Hand the accumulated rows over as a zero-copy row view; the parser
+     * keeps no rows afterwards
+     * @returns Row view over the parsed data
+     */
+    getRowsView(): CisvRowView;
+
     /**
      * Clear accumulated data
      */
@@ -200,6 +310,17 @@ declare module 'cisv' {
       context?: TransformContext
     ): this;
 
+    /**
+     * Add a batched JavaScript transform. The function is called once per
+     * batch of a column's values instead of once per field, and runs after
+     * the other transforms on that field.
+     * @param fieldIndex - Field index (0-based), use -1 for all fields
+     * @param transform - Batch transform function
+     * @param batchSize - Values per call (default: 1024)
+     * @returns Parser instance for chaining
+     */
+    transformBatch(fieldIndex: number, transform: BatchTransformFn, batchSize?: number): this;
+
     /**
      * Add row-level transform
      * @param transform - Row transform function
@@ -227,6 +348,16 @@ declare module 'cisv' {
      */
     clearTransforms(): this;
 
+    /**
+     * Set the number of the next row. Rows are numbered from 0 across all
+     * parses of this parser, and AES transforms derive each nonce from the
+     * row number, so a decrypting parser uses this to line up with the rows
+     * the encrypting parser saw.
+     * @param row - Row number of the next row
+     * @returns Parser instance for chaining
+     */
+    setRow(row: number): this;
+
     /**
      * Get parsing statistics
      * @returns Statistics object
@@ -282,6 +413,15 @@ declare module 'cisv' {
      */
     fetchRow(): ParsedRow | null;
 
+    /**
+     * Fetch up to maxRows rows from the iterator in a single native call.
+     *
+     * @param maxRows - Maximum rows to return (default 1024)
+     * @returns Array of rows (at least one), or null if at end of file
+     * @throws Error if no iterator is open (call openIterator first)
+     */
+    fetchRows(maxRows?: number): ParsedRow[] | null;
+
     /**
      * Close the iterator and release resources.
      *
@@ -318,6 +458,12 @@ declare module 'cisv' {
     readonly TO_INT: 'to_int';
     readonly TO_FLOAT: 'to_float';
     readonly HASH_SHA256: 'hash_sha256';
+    readonly HASH_MD5: 'hash_md5';
+    readonly HASH_XXH3: 'hash_xxh3';
+    readonly ENCRYPT_AES256: 'encrypt_aes256';
+    readonly DECRYPT_AES256: 'decrypt_aes256';
+    readonly ENCRYPT_AES256_CTR: 'encrypt_aes256_ctr';
+    readonly DECRYPT_AES256_CTR: 'decrypt_aes256_ctr';
     readonly BASE64_ENCODE: 'base64_encode';
   };
 
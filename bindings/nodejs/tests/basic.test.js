@@ -1,4 +1,7 @@
-const { cisvParser } = require('../build/Release/cisv');
+const addon = require('../build/Release/cisv');
+const { defineParseStream } = require('../cisv/stream');
+const { cisvParser } = addon;
+const CisvParseStream = defineParseStream(addon.cisvStreamParser);
 const assert = require('assert');
 const fs = require('fs');
 const path = require('path');
@@ -287,6 +290,61 @@ describe('CSV Parser Core Functionality', () => {
     //   assert.strictEqual(rows[1][0], 'jane'); // No transform applied
     // });
 
+    it('should apply batched JavaScript transforms', () => {
+      const parser = new cisvParser();
+      const batches = [];
+      parser.transformBatch(1, (values, field) => {
+        assert.strictEqual(field, 1);
+        batches.push(values.length);
+        return values.map((v) => v.toUpperCase());
+      }, 300);
+      const rows = parser.parseSync(largeFile);
+
+      assert.strictEqual(rows.length, 1001);
+      assert.strictEqual(rows[0][1], 'VALUE');
+      assert.strictEqual(rows[1000][1], 'VALUE 999');
+      assert.deepStrictEqual(batches, [300, 300, 300, 101]);
+    });
+
+    it('should keep the unfinished row queued when flushing batches early', () => {
+      const parser = new cisvParser();
+      parser.transformBatch(-1, (values) => values.map((v) => v.toUpperCase()), 100);
+      parser.write('a,b\nc,d\ne,');
+
+      assert.deepStrictEqual(parser.getRows(), [['A', 'B'], ['C', 'D']]);
+
+      parser.write('f\n');
+      parser.end();
+      assert.deepStrictEqual(parser.getRows(), [['A', 'B'], ['C', 'D'], ['E', 'F']]);
+    });
+
+    it('should throw what a batched transform throws', () => {
+      const parser = new cisvParser();
+      parser.transformBatch(1, () => { throw new Error('batch failed'); }, 2);
+
+      assert.throws(() => parser.parseSync(largeFile), /batch failed/);
+      assert.throws(() => parser.parseString('a,b\nc,d'), /batch failed/);
+    });
+
+    it('should never reuse AES row numbers across parses', () => {
+      const aes = { key: '00'.repeat(32), iv: '11'.repeat(12) };
+      const parser = new cisvParser();
+      parser.transform(1, 'encrypt_aes256', aes);
+      const first = parser.parseSync(testFile);
+      const second = parser.parseSync(testFile);
+      for (let i = 0; i < first.length; i++) {
+        assert.notStrictEqual(second[i][1], first[i][1]);
+      }
+
+      // The second parse numbered its rows 4..7
+      const decrypter = new cisvParser();
+      decrypter.transform(1, 'decrypt_aes256', aes);
+      const tail = second.slice(2).map((row) => `x,${row[1]}`).join('\n');
+      decrypter.setRow(6);
+      const plain = decrypter.parseString(tail);
+      assert.deepStrictEqual(plain.map((row) => row[1]), ['Jane Doe', 'Alex "The Boss"']);
+    });
+
     it('should get transform info', () => {
       const parser = new cisvParser();
       parser.transform(0, 'uppercase');
@@ -383,6 +441,197 @@ describe('CSV Parser Core Functionality', () => {
       }
     });
   });
+
+  describe('Row Views', () => {
+    it('should expose rows lazily without copying', () => {
+      const parser = new cisvParser();
+      const view = parser.parseViewSync(testFile);
+
+      assert.strictEqual(view.rowCount, 4);
+      assert.ok(view.buffer instanceof ArrayBuffer);
+      assert.strictEqual(view.rowStarts.length, 5);
+      assert.strictEqual(view.fieldCount(1), 3);
+      assert.strictEqual(view.get(2, 1), 'Jane Doe');
+      assert.strictEqual(view.get(3, 1), 'Alex "The Boss"');
+      assert.strictEqual(view.get(9, 0), undefined);
+      assert.deepStrictEqual(view.row(0), ['id', 'name', 'email']);
+      assert.deepStrictEqual(view.toArray(), parser.parseSync(testFile));
+
+      const bytes = new Uint8Array(view.buffer, view.offsets[4], view.lengths[4]);
+      assert.strictEqual(Buffer.from(bytes).toString(), 'John');
+    });
+
+    it('should match parse() when parsing asynchronously', async () => {
+      const parser = new cisvParser();
+      const view = await parser.parseView(largeFile);
+
+      assert.deepStrictEqual(view.toArray(), await parser.parse(largeFile));
+    });
+
+    it('should pack transformed rows', () => {
+      const parser = new cisvParser();
+      parser.transform(1, 'uppercase');
+      const view = parser.parseStringView('id,name\n1,john');
+
+      assert.strictEqual(view.get(1, 1), 'JOHN');
+    });
+
+    it('should outlive the parser and garbage collection', () => {
+      const gc = global.gc || (() => {});
+      const parser = new cisvParser();
+      const view = parser.parseViewSync(testFile);
+      const expected = view.toArray();
+      parser.transform(1, 'uppercase');
+      const packed = parser.parseStringView('id,name\n1,john');
+      parser.destroy();
+
+      // Unreferenced views are freed while the kept ones stay readable
+      for (let i = 0; i < 100; i++) new cisvParser().parseViewSync(largeFile);
+      gc();
+      gc();
+      assert.deepStrictEqual(view.toArray(), expected);
+      assert.strictEqual(packed.get(1, 1), 'JOHN');
+
+      // The buffer and index arrays do not depend on the view object
+      let dropped = new cisvParser().parseStringView('a,b\nxyz,w');
+      const { buffer, offsets, lengths } = dropped;
+      dropped = null;
+      gc();
+      gc();
+      const bytes = new Uint8Array(buffer, offsets[2], lengths[2]);
+      assert.strictEqual(Buffer.from(bytes).toString(), 'xyz');
+    });
+  });
+
+  describe('Parse Stream', () => {
+    it('should emit the same rows as parseSync in bounded batches', async () => {
+      const { Readable } = require('stream');
+      const { pipeline } = require('stream/promises');
+      const content = fs.readFileSync(largeFile);
+      const chunks = [];
+      for (let i = 0; i < content.length; i += 97) chunks.push(content.subarray(i, i + 97));
+
+      const rows = [];
+      await pipeline(
+        Readable.from(chunks),
+        new CisvParseStream({ batchSize: 100, highWaterMark: 2, maxBufferedBytes: 512 }),
+        async function (batches) {
+          for await (const batch of batches) {
+            assert.ok(batch.length <= 100);
+            rows.push(...batch);
+          }
+        }
+      );
+
+      assert.deepStrictEqual(rows, new cisvParser().parseSync(largeFile));
+    });
+
+    it('should emit row views when asked', async () => {
+      const stream = new CisvParseStream({ rowViews: true });
+      const batches = [];
+      stream.on('data', (batch) => batches.push(batch));
+      const done = new Promise((resolve) => stream.on('end', resolve));
+      stream.end('a,b\n1,2\n');
+      await done;
+
+      assert.strictEqual(batches.length, 1);
+      assert.strictEqual(batches[0].get(1, 1), '2');
+    });
+
+    it('should hold input and output to bounded buffers for a slow reader', async () => {
+      const { Readable } = require('stream');
+      const { pipeline } = require('stream/promises');
+      const { setTimeout: sleep } = require('timers/promises');
+      const content = fs.readFileSync(largeFile);
+      const chunks = [];
+      for (let i = 0; i < content.length; i += 64) chunks.push(content.subarray(i, i + 64));
+
+      const stream = new CisvParseStream({ batchSize: 10, highWaterMark: 2, maxBufferedBytes: 256 });
+      const nativeWrite = stream._native.write.bind(stream._native);
+      let heldWrites = 0;
+      stream._native.write = (chunk) => {
+        const accepted = nativeWrite(chunk);
+        if (!accepted) heldWrites++;
+        return accepted;
+      };
+
+      let rows = 0;
+      let maxBuffered = 0;
+      await pipeline(Readable.from(chunks), stream, async function (batches) {
+        for await (const batch of batches) {
+          rows += batch.length;
+          maxBuffered = Math.max(maxBuffered, stream.readableLength);
+          await sleep(1);
+        }
+      });
+
+      assert.strictEqual(rows, 1001);
+      assert.ok(heldWrites > 0, 'writes were never held back');
+      // Readable buffer plus the batches already queued or in flight natively
+      assert.ok(maxBuffered <= 5, `buffered ${maxBuffered} batches`);
+    });
+
+    it('should destroy the stream on a parse error', async () => {
+      const { Readable } = require('stream');
+      const { pipeline } = require('stream/promises');
+      const rows = [];
+
+      await assert.rejects(
+        pipeline(
+          Readable.from([Buffer.from('a,b\n1,2\n3,"unterminated\n')]),
+          new CisvParseStream(),
+          async function (batches) {
+            for await (const batch of batches) rows.push(...batch);
+          }
+        ),
+        /Unterminated quoted field/
+      );
+      assert.ok(rows.length <= 2);
+    });
+
+    it('should keep going past errors with skipLinesWithError', async () => {
+      const stream = new CisvParseStream({ skipLinesWithError: true });
+      const done = new Promise((resolve, reject) => {
+        stream.on('error', reject);
+        stream.on('end', resolve);
+      });
+      stream.resume();
+      stream.end('a,b\n1,"unterminated\n');
+      await done;
+    });
+
+    it('should not keep the process alive once written input is parsed', () => {
+      const { spawnSync } = require('child_process');
+      const script = `
+        const addon = require(${JSON.stringify(path.join(__dirname, '../build/Release/cisv'))});
+        const { defineParseStream } = require(${JSON.stringify(path.join(__dirname, '../cisv/stream'))});
+        const stream = new (defineParseStream(addon.cisvStreamParser))({ batchSize: 1 });
+        stream.on('data', () => {});
+        stream.write('a,b\\n1,2\\n');
+      `;
+      const result = spawnSync(process.execPath, ['-e', script], { timeout: 10000 });
+      assert.strictEqual(result.signal, null, 'process was still running after 10s');
+      assert.strictEqual(result.status, 0, result.stderr.toString());
+    });
+
+    it('should let an abandoned stream be collected', async function () {
+      if (!global.gc) this.skip();
+      const { setTimeout: sleep } = require('timers/promises');
+
+      const ref = (() => {
+        const stream = new CisvParseStream({ batchSize: 1 });
+        stream.on('data', () => {});
+        stream.write('a,b\n1,2\n');
+        return new WeakRef(stream);
+      })();
+
+      for (let i = 0; i < 50 && ref.deref(); i++) {
+        await sleep(10);
+        global.gc();
+      }
+      assert.strictEqual(ref.deref(), undefined);
+    });
+  });
 });
 
 // Additional test suite for advanced features
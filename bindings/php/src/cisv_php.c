@@ -491,6 +491,54 @@ PHP_METHOD(CisvParser, fetchRow) {
     }
 }
 
+/* PHP_METHOD(CisvParser, fetchRows) - Get up to max_rows rows from iterator */
+PHP_METHOD(CisvParser, fetchRows) {
+    zend_long max_rows = 1024;
+
+    ZEND_PARSE_PARAMETERS_START(0, 1)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_LONG(max_rows)
+    ZEND_PARSE_PARAMETERS_END();
+
+    cisv_parser_object *intern = Z_CISV_PARSER_P(ZEND_THIS);
+
+    if (!intern->iterator) {
+        zend_throw_exception(zend_ce_exception, "No iterator open. Call openIterator() first.", 0);
+        return;
+    }
+
+    if (max_rows < 1) {
+        zend_argument_value_error(1, "must be greater than 0");
+        return;
+    }
+
+    cisv_iterator_batch_t batch;
+    int result = cisv_iterator_next_batch(intern->iterator, (size_t)max_rows, &batch);
+
+    if (result == CISV_ITER_EOF) {
+        RETURN_FALSE;
+    }
+
+    if (result == CISV_ITER_ERROR) {
+        zend_throw_exception(zend_ce_exception, "Error reading CSV row", 0);
+        return;
+    }
+
+    /* Build PHP array of rows */
+    array_init_size(return_value, (uint32_t)batch.row_count);
+    for (size_t r = 0; r < batch.row_count; r++) {
+        size_t first = batch.row_offsets[r];
+        size_t count = batch.row_offsets[r + 1] - first;
+
+        zval row;
+        array_init_size(&row, (uint32_t)count);
+        for (size_t i = 0; i < count; i++) {
+            add_next_index_stringl(&row, batch.fields[first + i], batch.lengths[first + i]);
+        }
+        add_next_index_zval(return_value, &row);
+    }
+}
+
 /* PHP_METHOD(CisvParser, closeIterator) - Close the iterator */
 PHP_METHOD(CisvParser, closeIterator) {
     ZEND_PARSE_PARAMETERS_NONE();
@@ -547,6 +595,10 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_cisv_fetchRow, 0, 0, MAY_BE_ARRAY|MAY_BE_FALSE)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_cisv_fetchRows, 0, 0, MAY_BE_ARRAY|MAY_BE_FALSE)
+    ZEND_ARG_TYPE_INFO(0, max_rows, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_cisv_closeIterator, 0, 0, CisvParser, 0)
 ZEND_END_ARG_INFO()
 
@@ -562,6 +614,7 @@ static const zend_function_entry cisv_parser_methods[] = {
     PHP_ME(CisvParser, parseFileBenchmark, arginfo_cisv_parseFileBenchmark, ZEND_ACC_PUBLIC)
     PHP_ME(CisvParser, openIterator, arginfo_cisv_openIterator, ZEND_ACC_PUBLIC)
     PHP_ME(CisvParser, fetchRow, arginfo_cisv_fetchRow, ZEND_ACC_PUBLIC)
+    PHP_ME(CisvParser, fetchRows, arginfo_cisv_fetchRows, ZEND_ACC_PUBLIC)
     PHP_ME(CisvParser, closeIterator, arginfo_cisv_closeIterator, ZEND_ACC_PUBLIC)
     PHP_FE_END
 };
@@ -108,6 +108,15 @@ if (false) {
          */
         public function fetchRow(): array|false {}
 
+        /**
+         * Fetch up to $max_rows rows from the iterator in one native call.
+         *
+         * @param int $max_rows Maximum rows to return (default 1024)
+         * @return array<int, array<int, string>>|false Rows, or false at EOF
+         * @throws \RuntimeException If no iterator is open
+         */
+        public function fetchRows(int $max_rows = 1024): array|false {}
+
         /**
          * Close the iterator and release resources.
          *
@@ -149,6 +149,18 @@ class CisvIterator:
         """
         ...
 
+    def next_batch(self, max_rows: int = 1024) -> List[List[str]] | None:
+        """
+        Get up to max_rows rows in a single native call.
+
+        Args:
+            max_rows: Maximum number of rows to return (default: 1024)
+
+        Returns:
+            List of rows (at least one), or None if EOF
+        """
+        ...
+
     def close(self) -> None:
         """Close the iterator and release resources."""
         ...
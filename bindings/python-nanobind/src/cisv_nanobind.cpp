@@ -12,6 +12,7 @@
 #include <nanobind/ndarray.h>
 #include <stdexcept>
 #include <string>
+#include <cstdint>
 #include <cstring>
 #include <thread>
 #include <vector>
@@ -20,9 +21,28 @@
 extern "C" {
 #include "cisv/parser.h"
 }
+#include "cisv/interner.h"
 
 namespace nb = nanobind;
 
+/**
+ * Per-column string interning for the batch-to-Python conversion (see
+ * cisv/interner.h): equal short fields of a low-cardinality column share one
+ * str object. Cached strs are owned references, so an interner may live as
+ * long as the parse or iterator it serves.
+ */
+class StrInterner {
+public:
+    nb::str get(size_t column, const char *data, size_t len) {
+        return nb::borrow<nb::str>(impl_.get(column, data, len, [](const char *d, size_t n) {
+            return nb::object(nb::str(d, n));
+        }));
+    }
+
+private:
+    cisv::StringInterner<nb::object> impl_;
+};
+
 /**
  * Parse a CSV file and return all rows at once.
  *
@@ -70,13 +90,14 @@ static nb::list parse_file(
     }
 
     // Convert to Python list (single conversion pass)
+    StrInterner interner;
     nb::list rows;
     for (size_t i = 0; i < result->row_count; i++) {
         nb::list row;
         cisv_row_t *r = &result->rows[i];
         for (size_t j = 0; j < r->field_count; j++) {
             // Create Python string from field data
-            row.append(nb::str(r->fields[j], r->field_lengths[j]));
+            row.append(interner.get(j, r->fields[j], r->field_lengths[j]));
         }
         rows.append(row);
     }
@@ -124,12 +145,13 @@ static nb::list parse_string(
     }
 
     // Convert to Python list
+    StrInterner interner;
     nb::list rows;
     for (size_t i = 0; i < result->row_count; i++) {
         nb::list row;
         cisv_row_t *r = &result->rows[i];
         for (size_t j = 0; j < r->field_count; j++) {
-            row.append(nb::str(r->fields[j], r->field_lengths[j]));
+            row.append(interner.get(j, r->fields[j], r->field_lengths[j]));
         }
         rows.append(row);
     }
@@ -184,6 +206,7 @@ static nb::list parse_file_parallel(
     }
 
     // Merge all results into a single list
+    StrInterner interner;
     nb::list rows;
     for (int chunk = 0; chunk < result_count; chunk++) {
         cisv_result_t *result = results[chunk];
@@ -199,7 +222,7 @@ static nb::list parse_file_parallel(
             nb::list row;
             cisv_row_t *r = &result->rows[i];
             for (size_t j = 0; j < r->field_count; j++) {
-                row.append(nb::str(r->fields[j], r->field_lengths[j]));
+                row.append(interner.get(j, r->fields[j], r->field_lengths[j]));
             }
             rows.append(row);
         }
@@ -450,6 +473,7 @@ private:
     cisv_iterator_t *it_;
     bool closed_;
     std::string path_;
+    StrInterner interner_;  // Shared by every row of the file
 
 public:
     CisvIterator(const std::string &path,
@@ -513,11 +537,44 @@ public:
 
         nb::list row;
         for (size_t i = 0; i < field_count; i++) {
-            row.append(nb::str(fields[i], lengths[i]));
+            row.append(interner_.get(i, fields[i], lengths[i]));
         }
         return row;
     }
 
+    /**
+     * Get up to max_rows rows in one native call, or None if at end of file.
+     */
+    nb::object next_batch(size_t max_rows) {
+        if (closed_ || !it_) {
+            return nb::none();
+        }
+        if (max_rows == 0) {
+            throw std::invalid_argument("max_rows must be at least 1");
+        }
+
+        cisv_iterator_batch_t batch;
+        int result = cisv_iterator_next_batch(it_, max_rows, &batch);
+
+        if (result == CISV_ITER_EOF) {
+            return nb::none();
+        }
+        if (result == CISV_ITER_ERROR) {
+            throw std::runtime_error("Error reading CSV row from: " + path_);
+        }
+
+        nb::list rows;
+        for (size_t r = 0; r < batch.row_count; r++) {
+            nb::list row;
+            size_t first = batch.row_offsets[r];
+            for (size_t i = first; i < batch.row_offsets[r + 1]; i++) {
+                row.append(interner_.get(i - first, batch.fields[i], batch.lengths[i]));
+            }
+            rows.append(row);
+        }
+        return rows;
+    }
+
     /**
      * Close the iterator and release resources.
      */
@@ -526,6 +583,7 @@ public:
             cisv_iterator_close(it_);
             it_ = nullptr;
             closed_ = true;
+            interner_ = StrInterner();
         }
     }
 
@@ -594,6 +652,9 @@ NB_MODULE(_core, m) {
              "    skip_empty_lines: Whether to skip empty lines")
         .def("next", &CisvIterator::next,
              "Get the next row as a list of strings, or None if at end of file.")
+        .def("next_batch", &CisvIterator::next_batch,
+             nb::arg("max_rows") = 1024,
+             "Get up to max_rows rows as a list of lists, or None if at end of file.")
         .def("close", &CisvIterator::close,
              "Close the iterator and release resources.")
         .def_prop_ro("closed", &CisvIterator::is_closed,
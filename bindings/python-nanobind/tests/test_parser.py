@@ -248,6 +248,28 @@ class TestEdgeCases:
         rows = cisv.parse_string(data)
         assert rows == [["a,b,c", "d"]]
 
+    def test_repeated_values_share_objects(self):
+        """Test that repeated values in a low-cardinality column share one str."""
+        data = "".join(f"{i},{('open', 'closed')[i % 2]}\n" for i in range(1000))
+        rows = cisv.parse_string(data)
+        assert rows[2][1] is rows[4][1]
+        assert rows[1][1] == "closed"
+        assert len({id(row[1]) for row in rows}) == 2
+        assert rows[999] == ["999", "closed"]
+
+    def test_iterator_shares_objects_across_batches(self, tmp_path):
+        """Test that an iterator interns values across rows and batches."""
+        csv_file = tmp_path / "status.csv"
+        csv_file.write_text("".join(f"{i},{('open', 'closed')[i % 2]}\n" for i in range(100)))
+        with cisv.open_iterator(str(csv_file)) as it:
+            first = it.next()
+            batch_a = it.next_batch(10)
+            batch_b = it.next_batch(10)
+        assert first == ["0", "open"]
+        assert batch_a[1][1] is first[1]
+        assert batch_b[0][1] is batch_a[0][1]
+        assert batch_b[9] == ["20", "open"]
+
 
 class TestValidation:
     """Tests for input validation."""
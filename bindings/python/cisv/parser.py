@@ -97,6 +97,7 @@ def _get_lib():
 FieldCallback = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_char_p, ctypes.c_size_t)
 RowCallback = ctypes.CFUNCTYPE(None, ctypes.c_void_p)
 ErrorCallback = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int, ctypes.c_char_p)
+ReleaseCallback = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_size_t)
 
 # Config structure - must match cisv_config in parser.h exactly
 class CisvConfig(ctypes.Structure):
@@ -112,10 +113,16 @@ class CisvConfig(ctypes.Structure):
         ('from_line', ctypes.c_int),
         ('to_line', ctypes.c_int),
         ('skip_lines_with_error', ctypes.c_bool),
+        ('mmap_window', ctypes.c_size_t),
+        ('io_strategy', ctypes.c_int),
+        ('select_columns', ctypes.POINTER(ctypes.c_int)),
+        ('select_count', ctypes.c_size_t),
         ('field_cb', FieldCallback),
         ('row_cb', RowCallback),
         ('error_cb', ErrorCallback),
         ('user', ctypes.c_void_p),
+        ('release_cb', ReleaseCallback),
+        ('dictionary_encode', ctypes.c_bool),
     ]
 
 def _setup_bindings(lib):
@@ -3,6 +3,7 @@
 import pytest
 import tempfile
 import os
+import re
 
 from cisv import CisvParser, parse_file, parse_string, count_rows
 
@@ -66,6 +67,21 @@ class TestCisvParser:
         rows = parse_string("")
         assert len(rows) == 0
 
+    def test_config_mirrors_header(self):
+        """The ctypes CisvConfig must list cisv_config's fields in C order."""
+        from cisv.parser import CisvConfig
+
+        header = os.path.join(os.path.dirname(__file__), '..', '..', '..',
+                              'core', 'include', 'cisv', 'parser.h')
+        if not os.path.exists(header):
+            pytest.skip("core headers not available")
+        with open(header) as f:
+            body = re.search(r'typedef struct cisv_config \{(.*?)\} cisv_config;',
+                             f.read(), re.S).group(1)
+        body = re.sub(r'//[^\n]*', '', body)
+        c_fields = re.findall(r'(\w+)\s*;', body)
+        assert [name for name, _ in CisvConfig._fields_] == c_fields
+
 
 if __name__ == '__main__':
     pytest.main([__file__, '-v'])
@@ -7,6 +7,7 @@
 #include <getopt.h>
 #include <time.h>
 #include <limits.h>
+#include <sys/stat.h>
 
 #include "cisv/parser.h"
 #include "cisv/writer.h"
@@ -97,8 +98,6 @@ typedef struct {
     char **current_row;
     size_t current_field_count;
     size_t current_field_capacity;
-    size_t current_input_col;
-    int current_select_pos;
     size_t current_row_num;
     int in_header;
 
@@ -113,29 +112,8 @@ static int compare_ints_asc(const void *a, const void *b) {
 
 static void field_callback(void *user, const char *data, size_t len) {
     cli_context *ctx = (cli_context *)user;
-    int should_store = 1;
-
-    if (ctx->select_cols && ctx->select_count > 0) {
-        should_store = 0;
-        int current_col = (int)ctx->current_input_col;
-
-        while (ctx->current_select_pos < ctx->select_count &&
-               ctx->select_cols[ctx->current_select_pos] < current_col) {
-            ctx->current_select_pos++;
-        }
-
-        if (ctx->current_select_pos < ctx->select_count &&
-            ctx->select_cols[ctx->current_select_pos] == current_col) {
-            should_store = 1;
-            ctx->current_select_pos++;
-        }
-    }
-
-    ctx->current_input_col++;
-    if (!should_store) {
-        return;
-    }
 
+    // Column selection is applied by the parser (config.select_columns)
     if (ctx->current_field_count >= ctx->current_field_capacity) {
         size_t new_capacity = ctx->current_field_capacity * 2;
         if (new_capacity < 16) new_capacity = 16;
@@ -168,8 +146,6 @@ static void row_callback(void *user) {
             free(ctx->current_row[i]);
         }
         ctx->current_field_count = 0;
-        ctx->current_input_col = 0;
-        ctx->current_select_pos = 0;
         ctx->current_row_num++;
         return;
     }
@@ -205,8 +181,6 @@ static void row_callback(void *user) {
         ctx->current_field_count = 0;
     }
 
-    ctx->current_input_col = 0;
-    ctx->current_select_pos = 0;
     ctx->row_count++;
     ctx->current_row_num++;
 }
@@ -218,6 +192,27 @@ static void error_callback(void *user, int line, const char *msg) {
     }
 }
 
+// Compression of a regular file, from its magic bytes
+static cisv_compression file_compression(const char *filename) {
+    uint8_t magic[4];
+    FILE *f = fopen(filename, "rb");
+    if (!f) return CISV_COMPRESSION_NONE;
+    size_t n = fread(magic, 1, sizeof(magic), f);
+    fclose(f);
+    return cisv_detect_compression(magic, n);
+}
+
+// Streaming needs a field callback to track partial fields across buffers
+static void count_field_callback(void *user, const char *data, size_t len) {
+    (void)user;
+    (void)data;
+    (void)len;
+}
+
+static void count_row_callback(void *user) {
+    (*(size_t *)user)++;
+}
+
 static void print_help(const char *prog) {
     printf("cisv - High-performance CSV parser\n\n");
     printf("Usage: %s [COMMAND] [OPTIONS] [FILE]\n\n", prog);
@@ -352,32 +347,16 @@ static int stream_rows_with_iterator(const char *filename, cisv_config *config,
 
         int first = 1;
 
-        if (ctx->select_cols && ctx->select_count > 0) {
-            for (int sel = 0; sel < ctx->select_count; sel++) {
-                int col = ctx->select_cols[sel];
-                if (col < 0 || (size_t)col >= field_count) {
-                    continue;
-                }
-                if (!first) {
-                    ENSURE_ROW_BUF(1);
-                    row_buf[used++] = config->delimiter;
-                }
-                ENSURE_ROW_BUF(lengths[col]);
-                memcpy(row_buf + used, fields[col], lengths[col]);
-                used += lengths[col];
-                first = 0;
-            }
-        } else {
-            for (size_t i = 0; i < field_count; i++) {
-                if (!first) {
-                    ENSURE_ROW_BUF(1);
-                    row_buf[used++] = config->delimiter;
-                }
-                ENSURE_ROW_BUF(lengths[i]);
-                memcpy(row_buf + used, fields[i], lengths[i]);
-                used += lengths[i];
-                first = 0;
+        // The iterator already returns only the selected columns
+        for (size_t i = 0; i < field_count; i++) {
+            if (!first) {
+                ENSURE_ROW_BUF(1);
+                row_buf[used++] = config->delimiter;
             }
+            ENSURE_ROW_BUF(lengths[i]);
+            memcpy(row_buf + used, fields[i], lengths[i]);
+            used += lengths[i];
+            first = 0;
         }
 
         ENSURE_ROW_BUF(1);
@@ -943,6 +922,10 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
+    // Push column selection down into the parser so skipped columns are never copied
+    config.select_columns = ctx.select_cols;
+    config.select_count = (size_t)ctx.select_count;
+
     if (optind < argc) {
         filename = argv[optind];
     }
@@ -962,6 +945,29 @@ int main(int argc, char *argv[]) {
         return 0;
     }
 
+    // Compressed files (gzip/zstd, by magic bytes) are inflated by the core
+    struct stat input_st;
+    bool mappable = stat(filename, &input_st) == 0 && S_ISREG(input_st.st_mode);
+    cisv_compression compression = mappable ? file_compression(filename) : CISV_COMPRESSION_NONE;
+
+    if (ctx.count_only && compression != CISV_COMPRESSION_NONE) {
+        size_t count = 0;
+        config.field_cb = count_field_callback;
+        config.row_cb = count_row_callback;
+        config.user = &count;
+        cisv_parser *counter = cisv_parser_create_with_config(&config);
+        int rc = counter ? cisv_parser_parse_compressed(counter, filename, 0) : -ENOMEM;
+        cisv_parser_destroy(counter);
+        free(ctx.current_row);
+        free(ctx.select_cols);
+        if (rc < 0) {
+            fprintf(stderr, "Parse error: %s\n", strerror(-rc));
+            return 1;
+        }
+        printf("%zu\n", count);
+        return 0;
+    }
+
     if (ctx.count_only) {
         size_t count = cisv_parser_count_rows_with_config(filename, &config);
         printf("%zu\n", count);
@@ -984,7 +990,8 @@ int main(int argc, char *argv[]) {
     setvbuf(ctx.output, NULL, _IOFBF, 1 << 20);
 
     // Fast path: iterator avoids per-field allocations for common full-stream output.
-    if (ctx.head == 0 && ctx.tail == 0 && getenv("CISV_STATS") == NULL) {
+    // It maps the file, so pipes and devices take the read pipeline below.
+    if (mappable && compression == CISV_COMPRESSION_NONE && ctx.head == 0 && ctx.tail == 0 && getenv("CISV_STATS") == NULL) {
         int iter_result = stream_rows_with_iterator(filename, &config, &ctx);
         if (iter_result < 0) {
             free(ctx.current_row);
@@ -1014,7 +1021,9 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
-    int result = cisv_parser_parse_file(parser, filename);
+    int result = compression != CISV_COMPRESSION_NONE
+               ? cisv_parser_parse_compressed(parser, filename, 0)
+               : cisv_parser_parse_file(parser, filename);
     if (result < 0) {
         fprintf(stderr, "Parse error: %s\n", strerror(-result));
         cisv_parser_destroy(parser);
@@ -1049,6 +1058,8 @@ int main(int argc, char *argv[]) {
     if (getenv("CISV_STATS")) {
         fprintf(stderr, "Rows processed: %zu\n", ctx.row_count);
         fprintf(stderr, "Current line: %d\n", cisv_parser_get_line_number(parser));
+        fprintf(stderr, "I/O strategy: %s\n",
+                cisv_io_strategy_name(cisv_parser_io_strategy(parser)));
     }
 
     cisv_parser_destroy(parser);
@@ -0,0 +1,118 @@
+#ifndef CISV_INTERNER_H
+#define CISV_INTERNER_H
+
+// Per-column string interning for the C++ language bindings (C++ only).
+//
+// Status, country and enum columns repeat a handful of values across millions
+// of rows. While a column has produced at most kMaxDistinct distinct short
+// values, equal fields share one host-language string; past that the column
+// stops caching for good and a string is built per field again. Keys are
+// copied, so one interner can serve a whole parse even when the field bytes
+// it saw are gone. Value is the host's string handle; if handles expire (an
+// N-API handle scope closing), clear() the interner before reusing it.
+
+#ifdef __cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace cisv {
+
+template <typename Value>
+class StringInterner {
+public:
+    // Cached Value for (data, len) in column, or make(data, len) on a miss
+    template <typename Make>
+    Value get(size_t column, const char *data, size_t len, Make &&make) {
+        if (len > kMaxLen || column >= kMaxColumns) return make(data, len);
+        if (column >= columns_.size()) columns_.resize(column + 1);
+
+        Column &col = columns_[column];
+        if (col.disabled) return make(data, len);
+        if (col.slots.empty()) col.slots.resize(kSlots);
+
+        uint64_t hash = hash_bytes(data, len);
+        for (size_t i = hash & (kSlots - 1);; i = (i + 1) & (kSlots - 1)) {
+            Slot &slot = col.slots[i];
+            if (!slot.used) {
+                Value value = make(data, len);
+                if (++col.distinct > kMaxDistinct) {
+                    col.disabled = true;
+                    std::vector<Slot>().swap(col.slots);
+                    std::string().swap(col.keys);
+                } else {
+                    slot.used = true;
+                    slot.hash = hash;
+                    slot.key = static_cast<uint32_t>(col.keys.size());
+                    slot.len = static_cast<uint32_t>(len);
+                    slot.value = value;
+                    col.keys.append(data, len);
+                }
+                return value;
+            }
+            if (slot.hash == hash && slot.len == len &&
+                memcmp(col.keys.data() + slot.key, data, len) == 0) {
+                return slot.value;
+            }
+        }
+    }
+
+    // Drop cached values; columns that repeated too little stay off
+    void clear() {
+        for (Column &col : columns_) {
+            if (col.distinct == 0 || col.disabled) continue;
+            for (Slot &slot : col.slots) slot = Slot();
+            col.keys.clear();
+            col.distinct = 0;
+        }
+    }
+
+private:
+    static constexpr size_t kMaxLen = 64;          // Longer values rarely repeat
+    static constexpr size_t kMaxColumns = 1024;
+    static constexpr size_t kMaxDistinct = 256;
+    static constexpr size_t kSlots = 512;          // Power of two, at most half full
+
+    struct Slot {
+        uint64_t hash = 0;
+        uint32_t key = 0;                          // Offset into Column::keys
+        uint32_t len = 0;
+        Value value = Value();
+        bool used = false;
+    };
+
+    struct Column {
+        std::vector<Slot> slots;
+        std::string keys;                          // Copies of the cached values
+        size_t distinct = 0;
+        bool disabled = false;
+    };
+
+    static uint64_t hash_bytes(const char *data, size_t len) {
+        uint64_t h = 0x9E3779B97F4A7C15ull ^ len;
+        size_t i = 0;
+        for (; i + 8 <= len; i += 8) {
+            uint64_t word;
+            memcpy(&word, data + i, 8);
+            h = (h ^ word) * 0xFF51AFD7ED558CCDull;
+            h ^= h >> 32;
+        }
+        if (i < len) {
+            uint64_t word = 0;
+            memcpy(&word, data + i, len - i);
+            h = (h ^ word) * 0xC4CEB9FE1A85EC53ull;
+        }
+        return h ^ (h >> 29);
+    }
+
+    std::vector<Column> columns_;
+};
+
+} // namespace cisv
+
+#endif // __cplusplus
+
+#endif // CISV_INTERNER_H
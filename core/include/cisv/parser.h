@@ -15,6 +15,16 @@ typedef struct cisv_config cisv_config;
 typedef void (*cisv_field_cb)(void *user, const char *data, size_t len);
 typedef void (*cisv_row_cb)(void *user);
 typedef void (*cisv_error_cb)(void *user, int line, const char *msg);
+typedef void (*cisv_release_cb)(void *user, const uint8_t *chunk, size_t len);
+
+// How cisv_parser_parse_file reads a regular file
+typedef enum {
+    CISV_IO_AUTO = 0,            // choose from file size, filesystem and a one-time calibration
+    CISV_IO_MMAP,                // whole-file mmap, prefaulted, MADV_HUGEPAGE
+    CISV_IO_MMAP_LAZY,           // mmap without populate, windowed past mmap_window
+    CISV_IO_PREAD,               // buffered reads into huge-page-backed buffers
+    CISV_IO_DIRECT,              // O_DIRECT read pipeline, bypasses the page cache
+} cisv_io_strategy;
 
 // Configuration structure for parser initialization
 typedef struct cisv_config {
@@ -31,11 +41,36 @@ typedef struct cisv_config {
     int to_line;                 // stop parsing at this line number (0 = until end)
     bool skip_lines_with_error;  // whether to skip lines that cause errors
 
+    // Mapped-input memory budget (parse_file and the iterator)
+    // Files larger than the window are mapped one window at a time and each
+    // window is released once consumed, so RSS stays flat for any file size.
+    // 0 = automatic (files over 1 GiB use 64 MiB windows), SIZE_MAX = whole file.
+    size_t mmap_window;
+    cisv_io_strategy io_strategy; // parse_file I/O path (default CISV_IO_AUTO)
+
+    // Column projection (optional)
+    // Only listed columns reach field_cb; others are skipped before any copy.
+    // Selected fields keep their file order. NULL/0 = all columns.
+    const int *select_columns;   // 0-based column indices to keep
+    size_t select_count;         // number of entries in select_columns
+
     // Callbacks
     cisv_field_cb field_cb;      // field callback
     cisv_row_cb row_cb;          // row callback
     cisv_error_cb error_cb;      // error callback (optional)
     void *user;                  // user data passed to callbacks
+
+    // Pinned streaming (optional)
+    // When set, cisv_parser_write keeps each chunk pinned and emits fields
+    // straight from it; only fields spanning chunks are stitched, once. The
+    // caller must keep a chunk valid until release_cb(user, chunk, len) is
+    // called, which happens in write order, at the latest in end()/destroy.
+    cisv_release_cb release_cb;
+
+    // Typed parsing (cisv_parse_*_typed)
+    // Dictionary-encode repetitive string columns as CISV_TYPE_DICT. Off by
+    // default, so typed string columns stay CISV_TYPE_STRING.
+    bool dictionary_encode;
 } cisv_config;
 
 // Initialize config with defaults
@@ -50,8 +85,57 @@ cisv_parser *cisv_parser_create(cisv_field_cb fcb, cisv_row_cb rcb, void *user);
 void cisv_parser_destroy(cisv_parser *parser);
 
 // Parse whole file (zero‑copy if possible)
+// Pipes, character devices and files that cannot be mmapped go through the
+// read pipeline below instead.
 int cisv_parser_parse_file(cisv_parser *parser, const char *path);
 
+// Strategy the last parse_file/parse_fd call used (CISV_IO_AUTO before any)
+cisv_io_strategy cisv_parser_io_strategy(const cisv_parser *parser);
+
+// Short name of a strategy: "auto", "mmap", "mmap-lazy", "pread", "direct"
+const char *cisv_io_strategy_name(cisv_io_strategy strategy);
+
+// Read pipeline for inputs that cannot or should not be mmapped (pipes,
+// FUSE/network mounts with slow page faults, O_DIRECT). queue_depth aligned
+// buffers are read ahead with io_uring (pread()/read() fallback) while the
+// oldest completed buffer is parsed through the streaming path.
+typedef struct {
+    size_t buffer_size;          // bytes per read, rounded up to 4 KiB (0 = 1 MiB)
+    int queue_depth;             // reads in flight for regular files (0 = 4, max 64)
+    bool direct;                 // cisv_parser_parse_file_read: open with O_DIRECT
+    bool use_io_uring;           // try io_uring before pread()/read() (default true)
+} cisv_read_config;
+
+// Initialize read config with defaults
+void cisv_read_config_init(cisv_read_config *config);
+
+// Parse everything readable from fd (regular file, pipe or socket); config
+// may be NULL. Regular files are read from offset 0 up to their size at
+// call time. fd is not closed. Returns 0 or -errno.
+int cisv_parser_parse_fd(cisv_parser *parser, int fd, const cisv_read_config *config);
+
+// Open path and parse it through the read pipeline; config may be NULL
+int cisv_parser_parse_file_read(cisv_parser *parser, const char *path,
+                                const cisv_read_config *config);
+
+// Compressed input formats, recognised by their magic bytes
+typedef enum {
+    CISV_COMPRESSION_NONE = 0,
+    CISV_COMPRESSION_GZIP,       // 1f 8b (zlib; BGZF blocks decode in parallel)
+    CISV_COMPRESSION_ZSTD,       // 28 b5 2f fd (libzstd; sized frames decode in parallel)
+} cisv_compression;
+
+// Detect the compression of a file from its first bytes (4 are enough)
+cisv_compression cisv_detect_compression(const uint8_t *data, size_t len);
+
+// Parse a gzip or zstd compressed file or pipe. Decoder threads fill a ring
+// of buffers that the calling thread parses in order, so decompression and
+// parsing overlap; callbacks run on the calling thread. threads <= 0 uses
+// one decoder per spare core (only block-structured inputs use more than
+// one). Uncompressed files are parsed like cisv_parser_parse_file.
+// Returns 0, -ENOTSUP (codec not compiled in), -EBADMSG (corrupt input) or -errno.
+int cisv_parser_parse_compressed(cisv_parser *parser, const char *path, int threads);
+
 // Fast counting mode - no callbacks
 size_t cisv_parser_count_rows(const char *path);
 size_t cisv_parser_count_rows_with_config(const char *path, const cisv_config *config);
@@ -144,21 +228,280 @@ cisv_result_t *cisv_parse_string_batch(const char *data, size_t len, const cisv_
 // Free result allocated by cisv_parse_file_batch or cisv_parse_string_batch
 void cisv_result_free(cisv_result_t *result);
 
+// =============================================================================
+// Columnar Batch API
+// One Arrow-style string array per column: offsets into a contiguous values
+// buffer plus an optional validity bitmap, so buffers can be handed to Arrow
+// C Data Interface consumers without copying
+// =============================================================================
+
+// Column value types (typed parsing only; plain columnar parsing keeps strings)
+typedef enum {
+    CISV_TYPE_STRING = 0,    // offsets/offsets64 + values
+    CISV_TYPE_INT64,         // data: int64_t per row
+    CISV_TYPE_FLOAT64,       // data: double per row
+    CISV_TYPE_BOOL,          // data: LSB-first bitmap (true/false, any case)
+    CISV_TYPE_DATE,          // data: int32_t days since 1970-01-01 (YYYY-MM-DD)
+    CISV_TYPE_DICT           // data: uint32_t code per row into offsets + values
+} cisv_type_t;
+
+// Single column, laid out like an Arrow utf8 (32-bit offsets) or large_utf8
+// (64-bit offsets) array. Exactly one of offsets/offsets64 is set.
+// Typed columns use data instead, with the same validity bitmap.
+// Dictionary columns keep each distinct value once in offsets/values
+// (dict_size + 1 offsets, always 32-bit) and a code per row in data, like an
+// Arrow dictionary array or a pandas Categorical.
+typedef struct {
+    cisv_type_t type;        // CISV_TYPE_STRING unless typed parsing chose another
+    void *data;              // Native values for typed columns (NULL for strings)
+    int32_t *offsets;        // length + 1 offsets into values (offset_width == 4)
+    int64_t *offsets64;      // length + 1 offsets into values (offset_width == 8)
+    int offset_width;        // 4, switches to 8 once values outgrow INT32_MAX
+    char *values;            // Field bytes back to back (not NUL-terminated)
+    size_t values_size;      // Bytes used in values
+    size_t values_capacity;  // Allocated capacity for values
+    size_t dict_size;        // Distinct values of a dictionary column
+    uint8_t *validity;       // LSB-first bitmap, bit set = field present (NULL = all present)
+    size_t null_count;       // Rows too short to reach this column
+    size_t length;           // Number of rows in this column
+    size_t capacity;         // Allocated rows for offsets/validity
+} cisv_column_t;
+
+// Complete columnar result
+typedef struct {
+    cisv_column_t *columns;  // Array of columns (widest row decides the count)
+    size_t column_count;     // Number of columns
+    size_t column_capacity;  // Allocated capacity for columns
+    size_t row_count;        // Number of rows (every column has this length)
+    char **names;            // Header names (typed parsing with header, else NULL)
+    size_t name_count;       // Entries in names (a name may be NULL)
+    int error_code;          // 0 = success, negative = error
+    char error_message[256]; // Error description
+} cisv_columnar_t;
+
+// Parse entire file into columns
+// Returns NULL on failure (check errno), caller must free with cisv_columnar_free()
+cisv_columnar_t *cisv_parse_file_columnar(const char *path, const cisv_config *config);
+
+// Parse string buffer into columns
+// Returns NULL on failure (check errno), caller must free with cisv_columnar_free()
+cisv_columnar_t *cisv_parse_string_columnar(const char *data, size_t len,
+                                            const cisv_config *config);
+
+// Parse file into typed columns. The first infer_rows data rows (0 = 1000)
+// decide each column's type: int64, float64, bool, date or string (empty
+// fields are nulls, integers with leading zeros stay strings). Later rows are
+// parsed straight into native arrays; a value that does not fit widens an
+// int64 column to float64 or, failing that, turns the column back to strings
+// so nothing is lost. Integers beyond +/-2^53 are never stored as float64
+// (doubles would round them): a column holding them stays int64 or strings.
+// With config->dictionary_encode set, string columns whose sampled values
+// repeat (at most half of them distinct) are dictionary-encoded. Distinct
+// values are counted as rows stream in and a column that passes 4096 of them
+// is expanded back to plain strings.
+// header: the first row supplies names and is not part of the data
+// Returns NULL on failure (check errno), caller must free with cisv_columnar_free()
+cisv_columnar_t *cisv_parse_file_typed(const char *path, const cisv_config *config,
+                                       bool header, size_t infer_rows);
+
+// Parse string buffer into typed columns (see cisv_parse_file_typed)
+cisv_columnar_t *cisv_parse_string_typed(const char *data, size_t len,
+                                         const cisv_config *config,
+                                         bool header, size_t infer_rows);
+
+// Whether a row holds a value (false for nulls and out-of-range rows)
+bool cisv_column_is_valid(const cisv_column_t *column, size_t row);
+
+// Field of a string or dictionary column (NULL if the row is out of range,
+// null or typed)
+const char *cisv_column_value(const cisv_column_t *column, size_t row, size_t *len);
+
+// Free result allocated by cisv_parse_file_columnar or cisv_parse_string_columnar
+void cisv_columnar_free(cisv_columnar_t *result);
+
+// =============================================================================
+// Arrow C Data Interface Export
+// Hands columnar results to pyarrow, polars, duckdb, ... through the stable
+// Arrow C ABI without copying and without linking against Arrow
+// =============================================================================
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+// Export a columnar result as a struct array with one child per column
+// (utf8, or large_utf8 for columns with 64-bit offsets; typed columns map to
+// int64, float64, bool and date32, dictionary columns to uint32 indices into
+// a utf8 dictionary). Column buffers are
+// moved, not copied: on success the result is consumed and freed, and the
+// consumer owns everything through the release callbacks.
+// Names come from result->names when set. Otherwise header takes them from
+// the first row (which is then left out through the child arrays' offset),
+// and without either they are "column_<i>"
+// Returns 0 on success, negative on error (check errno; result untouched)
+int cisv_columnar_export_arrow(cisv_columnar_t *result, bool header,
+                               struct ArrowSchema *schema, struct ArrowArray *array);
+
+// Parse file straight into Arrow C Data Interface structures
+// Recoverable parse errors (e.g. an unterminated quote) go to config->error_cb
+// and the parsed rows are still exported
+// Returns 0 on success, negative on I/O or allocation error (check errno)
+int cisv_parse_file_arrow(const char *path, const cisv_config *config, bool header,
+                          struct ArrowSchema *schema, struct ArrowArray *array);
+
 // =============================================================================
 // Parallel Batch Parsing API
 // Uses multiple threads for maximum throughput on large files
 // =============================================================================
 
 // Parse file in parallel using multiple threads
-// Returns array of results (one per chunk), caller must free with cisv_results_free()
+// Runs on one process-wide cisv_pool_t sized to the largest num_threads asked
+// for so far, using at most num_threads of its workers
+// Returns array of results (one per morsel, in file order), caller must free with cisv_results_free()
 // num_threads: number of threads to use (0 = auto-detect CPU count)
-// result_count: output parameter for number of results
+// result_count: output parameter for number of results. This is the number
+// of morsels (about 4 per thread, more for big files), not num_threads; the
+// whole file is the concatenation of all results in order
 cisv_result_t **cisv_parse_file_parallel(const char *path, const cisv_config *config,
                                           int num_threads, int *result_count);
 
+// Parse file in parallel and stream rows to config->field_cb/row_cb in file
+// order from the calling thread. Memory stays bounded by a reorder window of
+// morsels instead of growing with the file (see cisv_pool_stream_file)
+// Returns 0 on success, negative on error (check errno)
+int cisv_parse_file_parallel_stream(const char *path, const cisv_config *config,
+                                    int num_threads);
+
 // Free array of results from cisv_parse_file_parallel
 void cisv_results_free(cisv_result_t **results, int count);
 
+// =============================================================================
+// Thread Pool API
+// Persistent worker threads reused across parse calls. Files are split into
+// morsels that idle workers steal from each other, results stay in file order
+// Callbacks run on the calling thread and may start nested parses on the
+// same pool; a pool call made from one of its own workers runs inline there.
+// =============================================================================
+
+typedef struct cisv_pool cisv_pool_t;
+
+// Create a pool with num_threads workers (0 = auto-detect CPU count, max 64)
+// Returns NULL on failure (check errno)
+cisv_pool_t *cisv_pool_create(int num_threads);
+
+// Stop and join all workers; no parse may be running on the pool
+void cisv_pool_destroy(cisv_pool_t *pool);
+
+// Number of running workers
+int cisv_pool_size(const cisv_pool_t *pool);
+
+// Parse file on the pool (thread-safe, several callers may share one pool)
+// Returns one result per morsel in file order, free with cisv_results_free()
+// morsel_size: target bytes per morsel (0 = auto, 1-16MB depending on file size)
+cisv_result_t **cisv_pool_parse_file(cisv_pool_t *pool, const char *path,
+                                     const cisv_config *config, size_t morsel_size,
+                                     int *result_count);
+
+// Receives one parsed morsel at a time, in file order; the result is only
+// valid during the call. Return non-zero to stop the stream early.
+typedef int (*cisv_batch_cb)(void *user, const cisv_result_t *batch);
+
+// Ordered streaming parse on the pool. At most `window` morsels are parsed
+// ahead of delivery, so peak memory is about 2 x window x morsel_size whatever
+// the file size. Each morsel goes to batch_cb(config->user, ...) if given,
+// otherwise its rows are replayed through config->field_cb/row_cb.
+// morsel_size: target bytes per morsel (0 = 1MB), window: 0 = 2 x pool size
+// Returns 0 on success (also when stopped early), negative on error (check errno)
+int cisv_pool_stream_file(cisv_pool_t *pool, const char *path, const cisv_config *config,
+                          size_t morsel_size, int window, cisv_batch_cb batch_cb);
+
+// =============================================================================
+// Two-Stage Structural Index API
+// Stage 1 scans a buffer once with SIMD and records separator positions;
+// stage 2 materializes fields straight from the index without rescanning,
+// so only the columns that are actually needed cost anything
+// =============================================================================
+
+// Structural index over a borrowed buffer (positions are 32-bit offsets,
+// so a single index covers at most 4 GiB - index chunks for larger files)
+typedef struct {
+    const uint8_t *data;     // Indexed buffer (not owned, must outlive the index)
+    size_t size;             // Buffer size in bytes
+    uint32_t *seps;          // Offset of the separator ending each field (size = EOF)
+    uint64_t *quoted;        // Bitmap: bit i set if field i contains the quote char
+    size_t field_count;      // Number of entries in seps
+    size_t field_capacity;   // Allocated capacity for seps
+    uint32_t *rows;          // rows[r] = first field of row r, rows[row_count] = field_count
+    size_t row_count;        // Number of complete rows
+    size_t row_capacity;     // Allocated capacity for rows
+    char delimiter;          // Delimiter used to build the index
+    char quote;              // Quote character used to build the index
+    bool unterminated;       // Last field has an unterminated quote at EOF
+} cisv_index_t;
+
+// Stage 1: build a structural index for data[0..len)
+// Returns NULL on failure (errno = EFBIG if len exceeds 4 GiB, ENOMEM)
+cisv_index_t *cisv_index_build(const uint8_t *data, size_t len, const cisv_config *config);
+
+// Stage 1 for a chunk produced by cisv_split_chunks (offsets relative to chunk->start)
+cisv_index_t *cisv_index_build_chunk(const cisv_chunk_t *chunk, const cisv_config *config);
+
+// Free an index (the indexed buffer is not touched)
+void cisv_index_free(cisv_index_t *index);
+
+// Number of fields in a row (0 if row is out of range)
+size_t cisv_index_row_fields(const cisv_index_t *index, size_t row);
+
+// Stage 2: emit fields from the index through the parser's callbacks.
+// columns: optional list of column indices to emit per row (NULL = the parser's
+// select_columns projection, or all columns), unlisted columns are never touched.
+// Returns 0 on success, negative on error.
+int cisv_parse_index(cisv_parser *parser, const cisv_index_t *index,
+                     const int *columns, size_t column_count);
+
+// Stage 2 into a batch result (same layout as cisv_parse_file_batch)
+// Returns NULL on failure (check errno), caller must free with cisv_result_free()
+cisv_result_t *cisv_parse_index_batch(const cisv_index_t *index, const cisv_config *config,
+                                      const int *columns, size_t column_count);
+
 // =============================================================================
 // Platform-specific defines
 // =============================================================================
@@ -202,12 +545,30 @@ typedef struct cisv_iterator cisv_iterator_t;
 cisv_iterator_t *cisv_iterator_open(const char *path, const cisv_config *config);
 
 // Get next row - fields/lengths valid until next call or close
+// Fields are zero-copy spans into the read-only file mapping (quoted fields
+// with "" pairs are unescaped into an iterator buffer) and, unlike
+// cisv_result_t fields, are NOT NUL-terminated; always use lengths[i].
 // Returns: CISV_ITER_OK (success), CISV_ITER_EOF (done), CISV_ITER_ERROR (error)
 int cisv_iterator_next(cisv_iterator_t *it,
                        const char ***fields,
                        const size_t **lengths,
                        size_t *field_count);
 
+// Rows returned by cisv_iterator_next_batch (valid until next call or close)
+typedef struct {
+    const char **fields;        // Fields of all rows, row after row (not NUL-terminated)
+    const size_t *lengths;      // Field lengths
+    const size_t *row_offsets;  // Row r is fields[row_offsets[r] .. row_offsets[r + 1])
+    size_t row_count;           // Rows in this batch
+    size_t field_count;         // Total fields in this batch
+} cisv_iterator_batch_t;
+
+// Get up to max_rows rows at once (0 = 1024), amortizing per-row call
+// overhead for bindings. Returns CISV_ITER_OK with row_count >= 1,
+// CISV_ITER_EOF when no rows are left, or CISV_ITER_ERROR.
+int cisv_iterator_next_batch(cisv_iterator_t *it, size_t max_rows,
+                             cisv_iterator_batch_t *batch);
+
 // Close iterator and free all resources
 void cisv_iterator_close(cisv_iterator_t *it);
 
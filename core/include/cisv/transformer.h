@@ -27,8 +27,11 @@ typedef enum {
     // Crypto transforms
     TRANSFORM_HASH_MD5,
     TRANSFORM_HASH_SHA256,
-    TRANSFORM_ENCRYPT_AES256,
+    TRANSFORM_HASH_XXH3,         // Non-cryptographic 64-bit hash for bucketing
+    TRANSFORM_ENCRYPT_AES256,    // AES-256-GCM, base64 of ciphertext || tag
     TRANSFORM_DECRYPT_AES256,
+    TRANSFORM_ENCRYPT_AES256_CTR, // AES-256-CTR, base64 of ciphertext (no integrity)
+    TRANSFORM_DECRYPT_AES256_CTR,
 
     // Data transforms
     TRANSFORM_BASE64_ENCODE,
@@ -50,6 +53,13 @@ typedef struct {
 } cisv_transform_result_t;
 
 // Transform context (for crypto operations)
+// AES transforms take a 32-byte key and a 12-byte IV, each as raw bytes or
+// as hex text of twice the length. In a pipeline each field's nonce is
+// derived from the IV, the field index and the row number (see
+// cisv_transform_pipeline_set_row), so the IV must never be reused with the
+// same key. Standalone calls ignore the IV: each encryption draws a random
+// 96-bit nonce and emits base64(nonce || ciphertext [|| tag]), and decryption
+// reads the nonce back from its input.
 typedef struct {
     void *key;
     size_t key_len;
@@ -73,8 +83,34 @@ typedef struct {
     int field_index;  // -1 for all fields
     const char *field_name;  // Field name to match (alternative to index)
     void *js_callback;  // For JS callbacks (napi_ref)
+    void *state;  // Precomputed per-transform state (AES key schedule)
 } cisv_transform_t;
 
+// Column slice for batch transforms, in one of two forms:
+// contiguous (Arrow string layout, e.g. a cisv_column_t): value i is
+//   data[offsets[i] .. offsets[i + 1]) with 32- or 64-bit offsets;
+// gather (e.g. one column of a cisv_result_t): values[i], lengths[i],
+//   used when data is NULL.
+typedef struct {
+    const char *data;            // Value bytes back to back (contiguous form)
+    const int32_t *offsets;      // count + 1 offsets into data, or
+    const int64_t *offsets64;    // count + 1 64-bit offsets into data
+    const char *const *values;   // count value pointers (gather form)
+    const size_t *lengths;       // count value lengths (gather form)
+    size_t count;                // Number of values
+} cisv_string_slice_t;
+
+// Batch transform output: value i is data[offsets[i] .. offsets[i + 1]).
+// Zero-initialize once and reuse across calls; buffers only grow.
+typedef struct {
+    char *data;                  // Value bytes back to back
+    size_t size;                 // Bytes used in data
+    size_t capacity;             // Allocated bytes in data
+    int64_t *offsets;            // count + 1 offsets into data
+    size_t count;                // Number of values
+    size_t offsets_capacity;     // Allocated entries in offsets
+} cisv_string_batch_t;
+
 // Transform pipeline
 typedef struct {
     cisv_transform_t *transforms;
@@ -82,9 +118,12 @@ typedef struct {
     size_t capacity;
 
     // Memory pool for transformations
+    // Built-in transform results are bump-allocated here and stay valid until
+    // cisv_transform_pipeline_reset(); results that do not fit are malloc'd.
     char *buffer_pool;
     size_t pool_size;
     size_t pool_used;
+    size_t pool_overflow;  // bytes that missed the pool since the last reset
 
     // SIMD alignment
     size_t alignment;
@@ -104,6 +143,13 @@ typedef struct {
     // Hash table for O(1) header field name lookup
     int *header_hash_table;            // Hash table: hash -> field_index (-1 if empty)
     size_t header_hash_size;           // Size of hash table (power of 2)
+
+    // Intermediate column of cisv_transform_apply_column chains
+    cisv_string_batch_t column_scratch;
+
+    // Row number mixed into AES nonces; advanced by cisv_transform_pipeline_reset()
+    // and cisv_transform_apply_column()
+    uint64_t row;
 } cisv_transform_pipeline_t;
 
 typedef struct cisv_js_callback {
@@ -152,7 +198,24 @@ int cisv_transform_pipeline_add_by_name(
     cisv_transform_context_t *ctx
 );
 
+// Release every result handed out since the last reset (call from row_cb
+// once the row's transformed fields are consumed) and advance the row
+// number. Grows the pool if the last row did not fit, so steady-state rows
+// do no heap allocation.
+void cisv_transform_pipeline_reset(cisv_transform_pipeline_t *pipeline);
+
+// Set the row number of the next cisv_transform_apply calls (or of the first
+// value of the next cisv_transform_apply_column slice). Decryption must see
+// the same row and field numbering as encryption. A successful
+// cisv_transform_apply_column advances the row by the slice's value count, so
+// consecutive slices of one column continue the numbering; set the row again
+// before transforming another column of the same rows.
+void cisv_transform_pipeline_set_row(cisv_transform_pipeline_t *pipeline, uint64_t row);
+
 // Apply transforms
+// Results of built-in transforms point into the pipeline pool (needs_free
+// == 0) and are valid until the next cisv_transform_pipeline_reset();
+// cisv_transform_result_free() is safe to call on any result.
 cisv_transform_result_t cisv_transform_apply(
     cisv_transform_pipeline_t *pipeline,
     int field_index,
@@ -167,10 +230,46 @@ cisv_transform_result_t cisv_transform_trim(const char *data, size_t len, cisv_t
 cisv_transform_result_t cisv_transform_to_int(const char *data, size_t len, cisv_transform_context_t *ctx);
 cisv_transform_result_t cisv_transform_to_float(const char *data, size_t len, cisv_transform_context_t *ctx);
 cisv_transform_result_t cisv_transform_hash_sha256(const char *data, size_t len, cisv_transform_context_t *ctx);
+cisv_transform_result_t cisv_transform_hash_md5(const char *data, size_t len, cisv_transform_context_t *ctx);
+cisv_transform_result_t cisv_transform_hash_xxh3(const char *data, size_t len, cisv_transform_context_t *ctx);
 cisv_transform_result_t cisv_transform_base64_encode(const char *data, size_t len, cisv_transform_context_t *ctx);
 
+// AES-256 with the context key and a random per-call nonce carried in the
+// output (see cisv_transform_context_t); the result is empty on a bad key,
+// malformed input or a failed tag check
+cisv_transform_result_t cisv_transform_encrypt_aes256(const char *data, size_t len, cisv_transform_context_t *ctx);
+cisv_transform_result_t cisv_transform_decrypt_aes256(const char *data, size_t len, cisv_transform_context_t *ctx);
+cisv_transform_result_t cisv_transform_encrypt_aes256_ctr(const char *data, size_t len, cisv_transform_context_t *ctx);
+cisv_transform_result_t cisv_transform_decrypt_aes256_ctr(const char *data, size_t len, cisv_transform_context_t *ctx);
+
 void cisv_transform_result_free(cisv_transform_result_t *result);
 
+// Column-batch transforms
+// One call runs a built-in transform over a whole column slice (for example
+// 4096 values of a columnar result) with a kernel specialized per type:
+// case mapping in a single SIMD pass over contiguous values, trim through a
+// whitespace bitmap, integers parsed eight digits at a time. Results match
+// cisv_transform_apply value for value. Return 0, or -1 on bad arguments,
+// allocation failure or a type without a built-in kernel.
+
+// Apply the C transforms registered for field_index (global ones first);
+// JS callbacks are skipped as in cisv_transform_apply
+int cisv_transform_apply_column(
+    cisv_transform_pipeline_t *pipeline,
+    int field_index,
+    const cisv_string_slice_t *in,
+    cisv_string_batch_t *out
+);
+
+// Apply a single built-in transform
+int cisv_transform_column(cisv_transform_type_t type, const cisv_string_slice_t *in,
+                          cisv_string_batch_t *out);
+
+// Parse every value like TRANSFORM_TO_INT into values[0 .. in->count)
+int cisv_transform_column_to_int64(const cisv_string_slice_t *in, int64_t *values);
+
+void cisv_string_batch_free(cisv_string_batch_t *batch);
+
 // SIMD-optimized transforms
 #ifdef __AVX2__
 void cisv_transform_uppercase_simd(char *dst, const char *src, size_t len);
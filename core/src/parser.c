@@ -10,6 +10,29 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/uio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#ifdef __linux__
+#include <sys/vfs.h>
+#endif
+#ifdef CISV_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef CISV_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define CISV_HAVE_IO_URING 1
+#endif
+#endif
+#endif
 
 #ifdef __AVX512F__
 #include <immintrin.h>
@@ -27,6 +50,10 @@
 #include <emmintrin.h>
 #endif
 
+#ifdef __PCLMUL__
+#include <wmmintrin.h>
+#endif
+
 // Cache optimization constants
 #define CACHE_LINE_SIZE 64
 #define L1_SIZE (32 * 1024)
@@ -65,6 +92,9 @@ typedef struct cisv_parser {
     int from_line;
     int to_line;
     size_t max_row_size;
+    size_t mmap_window;          // Mapping window for parse_file (0 = automatic)
+    cisv_io_strategy io_strategy; // Configured parse_file strategy
+    cisv_io_strategy io_used;    // Strategy of the last parse_file/parse_fd
     bool skip_lines_with_error;
     bool has_row_controls;
     void (*parse_impl)(struct cisv_parser *p);
@@ -74,9 +104,31 @@ typedef struct cisv_parser {
     size_t fields;
     size_t current_row_fields;
     size_t current_row_size;
+    size_t current_col;          // Input column of the next field in the row
+    bool closed_quote_at_end;    // Streaming: previous chunk ended on a closing quote
+    uint8_t *held;               // Streaming: trailing quote/\r run of the last chunk, not parsed yet
+    size_t held_len;
+    size_t held_cap;
+
+    // Pinned streaming (release_cb): chunks stay referenced, not copied,
+    // until every field starting in them has been emitted
+    cisv_release_cb release_cb;
+    struct PinnedChunk *pins;    // Ring of referenced chunks, oldest first
+    size_t pin_head;
+    size_t pin_count;
+    size_t pin_cap;
+    size_t pin_field_off;        // Start of the pending field in the oldest pin
+    uint64_t pin_quote_carry;    // All ones while a quoted region spans chunks
+    bool pinned_mode;            // Pinned chunks were written since the last end()
     bool skip_current_row;
     bool row_is_comment;
 
+    // Column projection (NULL = all columns)
+    uint64_t *select_mask;       // Bit per selected column
+    size_t select_mask_cols;     // Columns covered by select_mask
+    int *select_list;            // Selected columns in ascending order
+    size_t select_list_count;
+
     // Buffer for accumulating quoted field content
     uint8_t *quote_buffer __attribute__((aligned(64)));
     size_t quote_buffer_size;
@@ -97,6 +149,35 @@ static const uint8_t ws_lookup[256] = {
 
 #define is_ws(c) (ws_lookup[(uint8_t)(c)])
 
+// Build a column bitmap from a projection list (negative indices are ignored)
+// Returns NULL when no projection is requested or on allocation failure
+static uint64_t *build_select_mask(const int *cols, size_t count, size_t *mask_cols) {
+    *mask_cols = 0;
+    if (!cols || count == 0) return NULL;
+
+    size_t max_col = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (cols[i] >= 0 && (size_t)cols[i] + 1 > max_col) max_col = (size_t)cols[i] + 1;
+    }
+
+    size_t words = max_col / 64 + 1;
+    uint64_t *mask = calloc(words, sizeof(uint64_t));
+    if (!mask) return NULL;
+
+    for (size_t i = 0; i < count; i++) {
+        if (cols[i] >= 0) mask[cols[i] >> 6] |= 1ULL << (cols[i] & 63);
+    }
+    *mask_cols = max_col;
+    return mask;
+}
+
+static inline bool select_mask_has(const uint64_t *mask, size_t mask_cols, size_t col) {
+    return !mask || (col < mask_cols && ((mask[col >> 6] >> (col & 63)) & 1));
+}
+
+// Column projection check for the current input column
+#define column_selected(p) select_mask_has((p)->select_mask, (p)->select_mask_cols, (p)->current_col)
+
 // =============================================================================
 // SWAR (SIMD Within A Register) - 1 Billion Row Challenge technique
 // Processes 8 bytes at a time without SIMD instructions
@@ -309,6 +390,17 @@ static inline bool append_to_stream_buffer(cisv_parser *p, const uint8_t *data,
 static inline void yield_field(cisv_parser *p, const uint8_t *start, const uint8_t *end) {
     if (!p->fcb) return;
 
+    // Column projection: drop unselected fields before any copy. Row controls
+    // still need every field (comment prefix, row size), so they check later.
+    if (__builtin_expect(p->select_mask != NULL, 0) && !p->has_row_controls &&
+        !column_selected(p)) {
+        p->current_col++;
+        if (p->streaming_mode) {
+            p->stream_buffer_pos = 0;
+        }
+        return;
+    }
+
     // In streaming mode, check if we have buffered partial field data
     // SECURITY: Add NULL check for stream_buffer to prevent NULL dereference
     if (p->streaming_mode && p->stream_buffer_pos > 0 && p->stream_buffer) {
@@ -357,7 +449,7 @@ static inline void yield_field(cisv_parser *p, const uint8_t *start, const uint8
 
         if (__builtin_expect(p->has_row_controls, 0)) {
             // Detect comment lines from the first unquoted field.
-            if (p->current_row_fields == 0) {
+            if (p->current_col == 0) {
                 p->row_is_comment = (field_len > 0 && start[0] == (uint8_t)p->comment && p->comment != 0);
                 if (p->row_is_comment) {
                     p->skip_current_row = true;
@@ -381,14 +473,18 @@ static inline void yield_field(cisv_parser *p, const uint8_t *start, const uint8
                 if (__builtin_expect(p->streaming_mode, 0)) {
                     p->stream_buffer_pos = 0;
                 }
+                p->current_col++;
                 return;
             }
         }
 
-        p->fcb(p->user, (const char*)start, end - start);
-        p->fields++;
-        p->current_row_fields++;
+        if (__builtin_expect(column_selected(p), 1)) {
+            p->fcb(p->user, (const char*)start, end - start);
+            p->fields++;
+            p->current_row_fields++;
+        }
     }
+    p->current_col++;
 
     // Clear stream buffer after yielding
     if (__builtin_expect(p->streaming_mode, 0)) {
@@ -396,12 +492,16 @@ static inline void yield_field(cisv_parser *p, const uint8_t *start, const uint8
     }
 }
 
-// Yield field from quote buffer
-static inline void yield_quoted_field(cisv_parser *p) {
+// Yield already-unescaped quoted field content (quote buffer or a zero-copy
+// span into the input when the field has no escaped quotes)
+static inline void yield_quoted_span(cisv_parser *p, const uint8_t *start, const uint8_t *end) {
     if (!p->fcb) return;
 
-    const uint8_t *start = p->quote_buffer;
-    const uint8_t *end = p->quote_buffer + p->quote_buffer_pos;
+    if (__builtin_expect(p->select_mask != NULL, 0) && !p->has_row_controls &&
+        !column_selected(p)) {
+        p->current_col++;
+        return;
+    }
 
     if (__builtin_expect(p->trim, 0)) {
         // Trim leading whitespace - expect few iterations
@@ -415,7 +515,7 @@ static inline void yield_quoted_field(cisv_parser *p) {
 
         if (__builtin_expect(p->has_row_controls, 0)) {
             // Quoted first fields are never comment-line prefixes.
-            if (p->current_row_fields == 0) {
+            if (p->current_col == 0) {
                 p->row_is_comment = false;
             }
 
@@ -433,16 +533,23 @@ static inline void yield_quoted_field(cisv_parser *p) {
             }
 
             if (p->skip_current_row) {
-                p->quote_buffer_pos = 0;
+                p->current_col++;
                 return;
             }
         }
 
-        p->fcb(p->user, (const char*)start, end - start);
-        p->fields++;
-        p->current_row_fields++;
+        if (__builtin_expect(column_selected(p), 1)) {
+            p->fcb(p->user, (const char*)start, end - start);
+            p->fields++;
+            p->current_row_fields++;
+        }
     }
+    p->current_col++;
+}
 
+// Yield field from quote buffer
+static inline void yield_quoted_field(cisv_parser *p) {
+    yield_quoted_span(p, p->quote_buffer, p->quote_buffer + p->quote_buffer_pos);
     p->quote_buffer_pos = 0;
 }
 
@@ -460,11 +567,12 @@ static inline void yield_stream_buffer_field(cisv_parser *p) {
         while (start < end && __builtin_expect(is_ws(*(end-1)), 0)) end--;
     }
 
-    if (__builtin_expect(start < end || !p->skip_empty_lines, 1)) {
+    if (__builtin_expect(start < end || !p->skip_empty_lines, 1) && column_selected(p)) {
         p->fcb(p->user, (const char*)start, end - start);
         p->fields++;
         p->current_row_fields++;
     }
+    p->current_col++;
 
     p->stream_buffer_pos = 0;
 }
@@ -479,6 +587,7 @@ static inline void yield_row(cisv_parser *p) {
         p->skip_current_row = false;
         p->current_row_fields = 0;
         p->current_row_size = 0;
+        p->current_col = 0;
         p->row_is_comment = false;
         return;
     }
@@ -487,13 +596,18 @@ static inline void yield_row(cisv_parser *p) {
     if (p->row_is_comment) {
         p->current_row_fields = 0;
         p->current_row_size = 0;
+        p->current_col = 0;
         p->row_is_comment = false;
         return;
     }
 
     // Skip empty rows if skip_empty_lines is enabled
-    if (p->skip_empty_lines && p->current_row_fields == 0) {
+    // Under projection a row may legitimately yield no selected fields; only
+    // a genuinely blank line (at most one input column) is skipped then.
+    if (p->skip_empty_lines && p->current_row_fields == 0 &&
+        (!p->select_mask || p->current_col <= 1)) {
         p->current_row_size = 0;
+        p->current_col = 0;
         p->row_is_comment = false;
         return;
     }
@@ -504,6 +618,7 @@ static inline void yield_row(cisv_parser *p) {
     p->rows++;
     p->current_row_fields = 0;
     p->current_row_size = 0;
+    p->current_col = 0;
     p->row_is_comment = false;
 }
 
@@ -520,8 +635,16 @@ static void parse_neon(cisv_parser *p);
 #if defined(__SSE2__) && !defined(__AVX2__) && !defined(__AVX512F__)
 static void parse_sse2(cisv_parser *p);
 #endif
+#if defined(__AVX512BW__) || defined(__AVX2__)
+#define CISV_HAVE_BITMASK_KERNEL 1
+static void parse_bitmask(cisv_parser *p);
+#endif
 // Scalar fallback for platforms without SIMD
 static void parse_scalar(cisv_parser *p);
+// Streaming entry points (cisv_parser_write with and without release_cb)
+static int parser_write_pinned(cisv_parser *p, const uint8_t *chunk, size_t len,
+                               cisv_release_cb release, void *user);
+static int parser_write_buffered(cisv_parser *p, const uint8_t *chunk, size_t len);
 
 static inline void parse_dispatch(cisv_parser *p) {
     if (p->parse_impl) {
@@ -530,6 +653,17 @@ static inline void parse_dispatch(cisv_parser *p) {
     }
 
 #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef CISV_HAVE_BITMASK_KERNEL
+#ifdef __AVX512BW__
+    if (__builtin_cpu_supports("avx512bw")) {
+#else
+    if (__builtin_cpu_supports("avx2")) {
+#endif
+        p->parse_impl = parse_bitmask;
+        p->parse_impl(p);
+        return;
+    }
+#endif
 #ifdef __AVX512F__
     if (__builtin_cpu_supports("avx512f")) {
         p->parse_impl = parse_avx512;
@@ -723,7 +857,7 @@ static void parse_avx512(cisv_parser *p) {
         }
     }
 
-    if (!p->streaming_mode && p->current_row_fields > 0) {
+    if (!p->streaming_mode && p->current_col > 0) {
         yield_row(p);
     }
 }
@@ -895,12 +1029,399 @@ static void parse_avx2(cisv_parser *p) {
         }
     }
 
-    if (!p->streaming_mode && p->current_row_fields > 0) {
+    if (!p->streaming_mode && p->current_col > 0) {
+        yield_row(p);
+    }
+}
+#endif
+
+// =============================================================================
+// Branchless quote-region primitives (simdjson technique)
+// Classifies 64 bytes per step into quote/delimiter/newline bitmasks and
+// derives the in-quote region with a carry-less prefix XOR, so structural
+// characters that fall inside quotes can be masked out without branching.
+// Shared by the bitmask parse kernel and the structural index builder.
+// =============================================================================
+
+// Classify one 64-byte block into quote/delimiter/newline bitmasks
+static inline void bitmask_classify_block(const uint8_t *block, uint8_t delim, uint8_t quote,
+                                          uint64_t *quote_bits, uint64_t *delim_bits,
+                                          uint64_t *nl_bits) {
+#if defined(__AVX512BW__)
+    __m512i chunk = _mm512_loadu_si512((const void *)block);
+    *quote_bits = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8((char)quote));
+    *delim_bits = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8((char)delim));
+    *nl_bits = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('\n'));
+#elif defined(__AVX2__)
+    const __m256i quote_v = _mm256_set1_epi8((char)quote);
+    const __m256i delim_v = _mm256_set1_epi8((char)delim);
+    const __m256i nl_v = _mm256_set1_epi8('\n');
+    __m256i lo = _mm256_loadu_si256((const __m256i *)block);
+    __m256i hi = _mm256_loadu_si256((const __m256i *)(block + 32));
+
+    *quote_bits = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, quote_v)) |
+                  ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, quote_v)) << 32);
+    *delim_bits = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, delim_v)) |
+                  ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, delim_v)) << 32);
+    *nl_bits = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, nl_v)) |
+               ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, nl_v)) << 32);
+#else
+    // Portable fallback: one mask bit per byte (auto-vectorizes where possible)
+    uint64_t q = 0, d = 0, n = 0;
+    for (int i = 0; i < 64; i++) {
+        uint8_t c = block[i];
+        q |= (uint64_t)(c == quote) << i;
+        d |= (uint64_t)(c == delim) << i;
+        n |= (uint64_t)(c == '\n') << i;
+    }
+    *quote_bits = q;
+    *delim_bits = d;
+    *nl_bits = n;
+#endif
+}
+
+// Inclusive prefix XOR: bit i = XOR of bits 0..i. Marks every byte from an
+// opening quote up to (not including) its closing quote.
+static inline uint64_t bitmask_prefix_xor(uint64_t bits) {
+#ifdef __PCLMUL__
+    __m128i v = _mm_set_epi64x(0, (long long)bits);
+    __m128i ones = _mm_set1_epi8((char)0xFF);
+    return (uint64_t)_mm_cvtsi128_si64(_mm_clmulepi64_si128(v, ones, 0));
+#else
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+#endif
+}
+
+// Materialize a quoted field span [start, end) where *start is the opening
+// quote. "" pairs are collapsed through quote_buffer only when present. In a
+// terminated span the first unpaired quote closes the field, and any bytes
+// between it and the separator are yielded as a separate unquoted field, the
+// same way the state-machine loops split them.
+static inline void yield_quoted_raw(cisv_parser *p, const uint8_t *start, const uint8_t *end,
+                                    bool terminated) {
+    const uint8_t quote = (uint8_t)p->quote;
+    const uint8_t *cs = start + 1;
+    const uint8_t *q = (cs < end) ? memchr(cs, quote, (size_t)(end - cs)) : NULL;
+
+    if (__builtin_expect(!q || (terminated && (q + 1 == end || q[1] != quote)), 1)) {
+        yield_quoted_span(p, cs, q ? q : end);
+    } else {
+        p->quote_buffer_pos = 0;
+        while (q) {
+            if (q + 1 < end && q[1] == quote) {
+                append_to_quote_buffer(p, cs, (size_t)(q - cs) + 1);
+                cs = q + 2;  // Escaped quote: keep one
+            } else if (terminated) {
+                break;
+            } else {
+                append_to_quote_buffer(p, cs, (size_t)(q - cs) + 1);
+                cs = q + 1;
+            }
+            q = (cs < end) ? memchr(cs, quote, (size_t)(end - cs)) : NULL;
+        }
+        const uint8_t *ce = q ? q : end;
+        if (cs < ce) append_to_quote_buffer(p, cs, (size_t)(ce - cs));
+        yield_quoted_field(p);
+    }
+
+    if (terminated && q && q + 1 < end) {
+        yield_field(p, q + 1, end);
+    }
+}
+
+static inline void bitmask_yield_field(cisv_parser *p, const uint8_t *start, const uint8_t *end) {
+    // Skip unselected columns before the quoted-field unescape copy
+    if (__builtin_expect(p->select_mask != NULL, 0) && !p->has_row_controls &&
+        !column_selected(p)) {
+        p->current_col++;
+        return;
+    }
+    if (start < end && *start == (uint8_t)p->quote) {
+        yield_quoted_raw(p, start, end, true);
+    } else {
+        yield_field(p, start, end);
+    }
+}
+
+#ifdef CISV_HAVE_BITMASK_KERNEL
+// Bitmask parse kernel: quoted and unquoted input run through the same loop;
+// quoted fields without escaped quotes are yielded zero-copy.
+// PERF: __attribute__((hot)) tells compiler this is frequently called
+__attribute__((hot))
+static void parse_bitmask(cisv_parser *p) {
+    // Streaming chunks may end mid-field; the state-machine loops own that case.
+    if (p->streaming_mode) {
+#ifdef __AVX512BW__
+        parse_avx512(p);
+#else
+        parse_avx2(p);
+#endif
+        return;
+    }
+
+    const uint8_t delim = (uint8_t)p->delimiter;
+    const uint8_t quote = (uint8_t)p->quote;
+    const uint8_t *end = p->end;
+    const uint8_t *field_start = p->field_start;
+    uint64_t quote_carry = 0;  // All ones while a quoted region spans blocks
+
+    while (p->cur < end) {
+        size_t remaining = (size_t)(end - p->cur);
+        size_t block_len = 64;
+        uint64_t valid = ~0ULL;
+        uint8_t tail[64];
+        const uint8_t *block = p->cur;
+
+        if (__builtin_expect(remaining < 64, 0)) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, p->cur, remaining);
+            block = tail;
+            block_len = remaining;
+            valid = (1ULL << remaining) - 1;
+        } else {
+            _mm_prefetch((const char *)(p->cur + PREFETCH_DISTANCE), _MM_HINT_T0);
+        }
+
+        uint64_t quote_bits, delim_bits, nl_bits;
+        bitmask_classify_block(block, delim, quote, &quote_bits, &delim_bits, &nl_bits);
+
+        // Long fields: no special byte leaves the quote parity unchanged
+        if (!((quote_bits | delim_bits | nl_bits) & valid)) {
+            p->cur += block_len;
+            continue;
+        }
+
+        uint64_t in_quote = bitmask_prefix_xor(quote_bits & valid) ^ quote_carry;
+        quote_carry = (uint64_t)((int64_t)in_quote >> 63);
+
+        uint64_t structural = (delim_bits | nl_bits) & ~in_quote & valid;
+        while (structural) {
+            int pos = __builtin_ctzll(structural);
+            const uint8_t *ptr = p->cur + pos;
+
+            if (nl_bits & (1ULL << pos)) {
+                const uint8_t *field_end = ptr;
+                if (field_end > field_start && *(field_end - 1) == '\r') {
+                    field_end--;
+                }
+                bitmask_yield_field(p, field_start, field_end);
+                yield_row(p);
+            } else {
+                bitmask_yield_field(p, field_start, ptr);
+            }
+            field_start = ptr + 1;
+            structural &= structural - 1;
+        }
+
+        p->cur += block_len;
+    }
+
+    if (quote_carry) {
+        // SECURITY: Report unterminated quote at EOF
+        if (p->ecb) {
+            p->ecb(p->user, p->line_num, "Unterminated quoted field at EOF");
+        }
+        // Still yield the partial content so data isn't lost
+        if (*field_start == quote) {
+            if (field_start + 1 < end) yield_quoted_raw(p, field_start, end, false);
+        } else {
+            yield_field(p, field_start, end);
+        }
+    } else if (field_start < end) {
+        bitmask_yield_field(p, field_start, end);
+    }
+
+    if (p->current_col > 0) {
         yield_row(p);
     }
+
+    p->field_start = field_start;
+    p->state = S_NORMAL;
 }
 #endif
 
+// =============================================================================
+// Pinned Streaming (cisv_config.release_cb)
+// The caller's chunks are referenced instead of copied. The bitmask kernel
+// runs over each chunk as it arrives, carrying the quote parity across
+// chunks, so fields inside a chunk are yielded zero-copy. A field that runs
+// past the end of its chunk keeps that chunk (and any chunk it fully covers)
+// pinned; when its end arrives the pieces are stitched into stream_buffer
+// once and the pins are released in order.
+// =============================================================================
+
+typedef struct PinnedChunk {
+    const uint8_t *data;
+    size_t len;
+    cisv_release_cb release;
+    void *user;
+} PinnedChunk;
+
+static inline PinnedChunk *pin_at(cisv_parser *p, size_t i) {
+    return &p->pins[(p->pin_head + i) % p->pin_cap];
+}
+
+static bool pin_push(cisv_parser *p, const uint8_t *data, size_t len,
+                     cisv_release_cb release, void *user) {
+    if (p->pin_count == p->pin_cap) {
+        size_t cap = p->pin_cap ? p->pin_cap * 2 : 8;
+        PinnedChunk *pins = malloc(cap * sizeof(PinnedChunk));
+        if (!pins) return false;
+        for (size_t i = 0; i < p->pin_count; i++) pins[i] = *pin_at(p, i);
+        free(p->pins);
+        p->pins = pins;
+        p->pin_cap = cap;
+        p->pin_head = 0;
+    }
+    *pin_at(p, p->pin_count) = (PinnedChunk){ data, len, release, user };
+    p->pin_count++;
+    return true;
+}
+
+// Release the oldest count pins
+static void pin_release(cisv_parser *p, size_t count) {
+    while (count-- > 0 && p->pin_count > 0) {
+        PinnedChunk c = *pin_at(p, 0);
+        p->pin_head = (p->pin_head + 1) % p->pin_cap;
+        p->pin_count--;
+        if (c.release) c.release(c.user, c.data, c.len);
+    }
+    p->pin_field_off = 0;
+}
+
+// Copy the pending field (from the oldest pin up to pins[pin_count - 1],
+// then tail_len bytes of tail) into stream_buffer. False when it exceeds the
+// field size limit.
+static bool pin_stitch(cisv_parser *p, const uint8_t *tail, size_t tail_len) {
+    p->stream_buffer_pos = 0;
+    for (size_t i = 0; i < p->pin_count; i++) {
+        const PinnedChunk *c = pin_at(p, i);
+        size_t off = i == 0 ? p->pin_field_off : 0;
+        if (c->len > off && !append_to_stream_buffer(p, c->data + off, c->len - off)) return false;
+    }
+    if (tail_len > 0 && !append_to_stream_buffer(p, tail, tail_len)) return false;
+    return true;
+}
+
+// Yield the field that began in an earlier chunk and ends at tail + tail_len
+static void pin_yield_spanning(cisv_parser *p, const uint8_t *tail, size_t tail_len, bool at_newline) {
+    if (!pin_stitch(p, tail, tail_len)) {
+        if (p->ecb) p->ecb(p->user, p->line_num, "Field exceeds maximum buffer size");
+        p->stream_buffer_pos = 0;
+    }
+    const uint8_t *start = p->stream_buffer;
+    const uint8_t *end = p->stream_buffer + p->stream_buffer_pos;
+    if (at_newline && end > start && *(end - 1) == '\r') end--;
+    bitmask_yield_field(p, start, end);
+    p->stream_buffer_pos = 0;
+}
+
+// Parse one pinned chunk (already pushed as the newest pin)
+static void parse_pinned_chunk(cisv_parser *p, const uint8_t *chunk, size_t len) {
+    const uint8_t delim = (uint8_t)p->delimiter;
+    const uint8_t quote = (uint8_t)p->quote;
+    const uint8_t *end = chunk + len;
+    const uint8_t *cur = chunk;
+    // NULL while the current field began in an earlier chunk
+    const uint8_t *field_start = p->pin_count > 1 ? NULL : chunk;
+    uint64_t quote_carry = p->pin_quote_carry;
+
+    while (cur < end) {
+        size_t remaining = (size_t)(end - cur);
+        uint64_t valid = ~0ULL;
+        uint8_t tail[64];
+        const uint8_t *block = cur;
+
+        if (__builtin_expect(remaining < 64, 0)) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, cur, remaining);
+            block = tail;
+            valid = (1ULL << remaining) - 1;
+        } else {
+            __builtin_prefetch(cur + PREFETCH_DISTANCE);
+        }
+
+        uint64_t quote_bits, delim_bits, nl_bits;
+        bitmask_classify_block(block, delim, quote, &quote_bits, &delim_bits, &nl_bits);
+
+        // Long fields: no special byte leaves the quote parity unchanged
+        if (!((quote_bits | delim_bits | nl_bits) & valid)) {
+            cur += remaining < 64 ? remaining : 64;
+            continue;
+        }
+
+        uint64_t in_quote = bitmask_prefix_xor(quote_bits & valid) ^ quote_carry;
+        quote_carry = (uint64_t)((int64_t)in_quote >> 63);
+
+        uint64_t structural = (delim_bits | nl_bits) & ~in_quote & valid;
+        while (structural) {
+            int pos = __builtin_ctzll(structural);
+            const uint8_t *ptr = cur + pos;
+            bool newline = (nl_bits >> pos) & 1;
+
+            if (__builtin_expect(!field_start, 0)) {
+                // Only the older pins plus this chunk's head form the field
+                p->pin_count--;
+                pin_yield_spanning(p, chunk, (size_t)(ptr - chunk), newline);
+                p->pin_count++;
+                pin_release(p, p->pin_count - 1);
+            } else {
+                const uint8_t *field_end = ptr;
+                if (newline && field_end > field_start && *(field_end - 1) == '\r') field_end--;
+                bitmask_yield_field(p, field_start, field_end);
+            }
+            if (newline) yield_row(p);
+            field_start = ptr + 1;
+            structural &= structural - 1;
+        }
+
+        cur += remaining < 64 ? remaining : 64;
+    }
+
+    p->pin_quote_carry = quote_carry;
+    if (!field_start) return;  // The field still spans every pinned chunk
+
+    // Everything up to field_start is emitted: keep the chunk only if a
+    // field is left open at its end
+    if (field_start < end) {
+        p->pin_field_off = (size_t)(field_start - chunk);
+    } else {
+        pin_release(p, p->pin_count);
+    }
+}
+
+// Flush the pinned field left at end of input, like parse_bitmask at EOF
+static void parse_pinned_end(cisv_parser *p) {
+    if (p->pin_count > 0) {
+        if (!pin_stitch(p, NULL, 0)) {
+            if (p->ecb) p->ecb(p->user, p->line_num, "Field exceeds maximum buffer size");
+            p->stream_buffer_pos = 0;
+        }
+        const uint8_t *start = p->stream_buffer;
+        const uint8_t *end = p->stream_buffer + p->stream_buffer_pos;
+        if (p->pin_quote_carry) {
+            if (p->ecb) p->ecb(p->user, p->line_num, "Unterminated quoted field at EOF");
+            if (start < end && *start == (uint8_t)p->quote) {
+                if (start + 1 < end) yield_quoted_raw(p, start, end, false);
+            } else {
+                yield_field(p, start, end);
+            }
+        } else if (start < end) {
+            bitmask_yield_field(p, start, end);
+        }
+        p->stream_buffer_pos = 0;
+        pin_release(p, p->pin_count);
+    }
+    if (p->current_col > 0) yield_row(p);
+    p->pin_quote_carry = 0;
+}
+
 #if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(__aarch64__)
 // ARM NEON fast path for Apple Silicon, AWS Graviton, Raspberry Pi
 // PERF: __attribute__((hot)) tells compiler this is frequently called
@@ -1084,7 +1605,7 @@ static void parse_neon(cisv_parser *p) {
         }
     }
 
-    if (!p->streaming_mode && p->current_row_fields > 0) {
+    if (!p->streaming_mode && p->current_col > 0) {
         yield_row(p);
     }
 }
@@ -1252,7 +1773,7 @@ static void parse_sse2(cisv_parser *p) {
         }
     }
 
-    if (!p->streaming_mode && p->current_row_fields > 0) {
+    if (!p->streaming_mode && p->current_col > 0) {
         yield_row(p);
     }
 }
@@ -1448,7 +1969,7 @@ static void parse_scalar(cisv_parser *p) {
         }
     }
 
-    if (!p->streaming_mode && p->current_row_fields > 0) {
+    if (!p->streaming_mode && p->current_col > 0) {
         yield_row(p);
     }
 }
@@ -1496,6 +2017,9 @@ cisv_parser *cisv_parser_create_with_config(const cisv_config *config) {
     p->from_line = config->from_line;
     p->to_line = config->to_line;
     p->max_row_size = config->max_row_size;
+    p->mmap_window = config->mmap_window;
+    p->io_strategy = config->io_strategy;
+    p->release_cb = config->release_cb;
     p->skip_lines_with_error = config->skip_lines_with_error;
     p->has_row_controls = (config->max_row_size > 0 || config->comment != 0);
 
@@ -1508,6 +2032,7 @@ cisv_parser *cisv_parser_create_with_config(const cisv_config *config) {
     p->line_num = 0;
     p->current_row_fields = 0;
     p->current_row_size = 0;
+    p->current_col = 0;
     p->skip_current_row = false;
     p->row_is_comment = false;
     p->parse_impl = NULL;
@@ -1533,6 +2058,26 @@ cisv_parser *cisv_parser_create_with_config(const cisv_config *config) {
     p->stream_buffer_pos = 0;
     p->streaming_mode = false;
 
+    // Column projection: unselected fields are skipped before any copy or callback
+    if (config->select_columns && config->select_count > 0) {
+        p->select_mask = build_select_mask(config->select_columns, config->select_count,
+                                           &p->select_mask_cols);
+        p->select_list = p->select_mask ? malloc(config->select_count * sizeof(int)) : NULL;
+        if (!p->select_list) {
+            free(p->select_mask);
+            free(p->stream_buffer);
+            free(p->quote_buffer);
+            free(p);
+            return NULL;
+        }
+        // Ascending, de-duplicated list for index-driven projection
+        for (size_t col = 0; col < p->select_mask_cols; col++) {
+            if (select_mask_has(p->select_mask, p->select_mask_cols, col)) {
+                p->select_list[p->select_list_count++] = (int)col;
+            }
+        }
+    }
+
     return p;
 }
 
@@ -1552,9 +2097,268 @@ void cisv_parser_destroy(cisv_parser *p) {
     if (p->fd >= 0) close(p->fd);
     if (p->quote_buffer) free(p->quote_buffer);
     if (p->stream_buffer) free(p->stream_buffer);
+    free(p->held);
+    pin_release(p, p->pin_count);
+    free(p->pins);
+    free(p->select_mask);
+    free(p->select_list);
     free(p);
 }
 
+// Files above this size are mapped in windows unless a window is configured
+#define MMAP_WINDOW_AUTO_LIMIT ((size_t)1 << 30)
+#define MMAP_WINDOW_DEFAULT ((size_t)64 << 20)
+
+// Mapping window for a file of size bytes; size means map the whole file
+static size_t mmap_window_for(size_t configured, size_t size) {
+    size_t window = configured;
+    if (window == 0) window = size > MMAP_WINDOW_AUTO_LIMIT ? MMAP_WINDOW_DEFAULT : size;
+    if (window >= size) return size;
+
+    // Window offsets must stay page aligned
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    window = (window + page - 1) & ~(page - 1);
+    return window < size ? window : size;
+}
+
+// Reset per-input parse state before a new file or fd is parsed
+static void parser_reset_input(cisv_parser *p) {
+    p->state = S_NORMAL;
+    p->line_num = 0;
+    p->current_row_fields = 0;
+    p->current_col = 0;
+    p->quote_buffer_pos = 0;
+    p->stream_buffer_pos = 0;
+    p->streaming_mode = false;
+    p->closed_quote_at_end = false;
+    p->held_len = 0;
+    pin_release(p, p->pin_count);
+    p->pin_quote_carry = 0;
+    p->pinned_mode = false;
+    p->current_row_size = 0;
+    p->skip_current_row = false;
+    p->row_is_comment = false;
+}
+
+static void window_release(void *user, const uint8_t *data, size_t len) {
+    (void)user;
+    munmap((void*)data, len);
+}
+
+// Parse p->fd through a sliding window: each window is pinned into the
+// streaming path and unmapped as soon as its last field is emitted, so only
+// the windows a field spans are resident and no field bytes are copied
+// except those that straddle a window boundary.
+static int parse_file_windowed(cisv_parser *p, size_t size, size_t window) {
+    parser_reset_input(p);
+
+    for (size_t offset = 0; offset < size; offset += window) {
+        size_t len = size - offset < window ? size - offset : window;
+        uint8_t *map = (uint8_t*)mmap(NULL, len, PROT_READ, MAP_PRIVATE, p->fd, (off_t)offset);
+        if (map == MAP_FAILED) {
+            int err = -errno;
+            parser_reset_input(p);
+            return err;
+        }
+        madvise(map, len, MADV_SEQUENTIAL);
+
+        // Start reading the next window while this one is parsed
+#ifdef POSIX_FADV_WILLNEED
+        if (offset + len < size) {
+            size_t next = size - offset - len < window ? size - offset - len : window;
+            posix_fadvise(p->fd, (off_t)(offset + len), (off_t)next, POSIX_FADV_WILLNEED);
+        }
+#endif
+
+        int err = parser_write_pinned(p, map, len, window_release, NULL);
+        if (err < 0) {
+            munmap(map, len);
+            parser_reset_input(p);
+            return err;
+        }
+    }
+
+    cisv_parser_end(p);
+    return 0;
+}
+
+// =============================================================================
+// I/O Strategy Selection
+// Small files are cheaper to read() than to map, large files on local disks
+// are cheapest to map prefaulted, files larger than the mapping budget slide
+// a lazy window, files that would flush the page cache bypass it, and
+// network mounts (slow page faults) are read ahead in large buffers.
+// =============================================================================
+
+#define IO_HUGE_PAGE ((size_t)2 << 20)
+#define IO_SMALL_FILE_MIN ((size_t)16 << 10)
+#define IO_SMALL_FILE_MAX ((size_t)4 << 20)
+#define IO_SMALL_FILE_DEFAULT ((size_t)64 << 10)
+#define IO_CALIBRATION_PROBE ((size_t)1 << 20)
+#define IO_CALIBRATION_ROUNDS 4
+
+// Filesystem magic numbers (linux/magic.h and friends)
+#define FS_MAGIC_TMPFS 0x01021994
+#define FS_MAGIC_NFS 0x6969
+#define FS_MAGIC_SMB 0x517B
+#define FS_MAGIC_CIFS 0xFF534D42
+#define FS_MAGIC_SMB2 0xFE534D42
+#define FS_MAGIC_FUSE 0x65735546
+#define FS_MAGIC_CEPH 0x00C36400
+#define FS_MAGIC_9P 0x01021997
+
+typedef enum { FS_LOCAL, FS_MEMORY, FS_REMOTE } FsKind;
+
+static FsKind io_fs_kind(int fd) {
+#ifdef __linux__
+    struct statfs sfs;
+    if (fstatfs(fd, &sfs) < 0) return FS_LOCAL;
+    switch ((uint32_t)sfs.f_type) {
+        case FS_MAGIC_TMPFS:
+            return FS_MEMORY;
+        case FS_MAGIC_NFS:
+        case FS_MAGIC_SMB:
+        case FS_MAGIC_CIFS:
+        case FS_MAGIC_SMB2:
+        case FS_MAGIC_FUSE:
+        case FS_MAGIC_CEPH:
+        case FS_MAGIC_9P:
+            return FS_REMOTE;
+        default:
+            return FS_LOCAL;
+    }
+#else
+    (void)fd;
+    return FS_LOCAL;
+#endif
+}
+
+static inline uint64_t io_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// Largest file that is read() rather than mapped. Measured once per process
+// on the first file large enough to probe: mapping costs a fixed setup plus
+// a per-page populate cost, reading costs a per-byte copy, and the crossover
+// of the two lines is the limit.
+static size_t io_small_file_limit = IO_SMALL_FILE_DEFAULT;
+static bool io_calibrated = false;
+static pthread_mutex_t io_calibration_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t io_probe_mmap(int fd, size_t len) {
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < IO_CALIBRATION_ROUNDS; r++) {
+        uint64_t t0 = io_now_ns();
+        void *m = mmap(NULL, len, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+        if (m == MAP_FAILED) return UINT64_MAX;
+        munmap(m, len);
+        uint64_t t = io_now_ns() - t0;
+        if (t < best) best = t;
+    }
+    return best;
+}
+
+static void io_calibrate(int fd, size_t size) {
+    pthread_mutex_lock(&io_calibration_lock);
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t probe = size < IO_CALIBRATION_PROBE ? size & ~(page - 1) : IO_CALIBRATION_PROBE;
+    uint8_t *buf = NULL;
+    if (io_calibrated || probe < 16 * page || !(buf = malloc(probe))) {
+        pthread_mutex_unlock(&io_calibration_lock);
+        return;
+    }
+
+    uint64_t read_ns = UINT64_MAX;
+    for (int r = 0; r < IO_CALIBRATION_ROUNDS; r++) {
+        uint64_t t0 = io_now_ns();
+        if (pread(fd, buf, probe, 0) != (ssize_t)probe) break;
+        uint64_t t = io_now_ns() - t0;
+        if (t < read_ns) read_ns = t;
+    }
+    free(buf);
+    uint64_t map_one = io_probe_mmap(fd, page);
+    uint64_t map_all = io_probe_mmap(fd, probe);
+
+    if (read_ns != UINT64_MAX && map_one != UINT64_MAX && map_all != UINT64_MAX) {
+        double per_byte_map = map_all > map_one ? (double)(map_all - map_one) / (double)(probe - page) : 0;
+        double per_byte_read = (double)read_ns / (double)probe;
+        double setup = (double)map_one - per_byte_map * (double)page;
+        double limit = per_byte_read > per_byte_map
+                     ? setup / (per_byte_read - per_byte_map)
+                     : (double)IO_SMALL_FILE_MAX;
+        if (limit < (double)IO_SMALL_FILE_MIN) limit = (double)IO_SMALL_FILE_MIN;
+        if (limit > (double)IO_SMALL_FILE_MAX) limit = (double)IO_SMALL_FILE_MAX;
+        __atomic_store_n(&io_small_file_limit, (size_t)limit, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&io_calibrated, true, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&io_calibration_lock);
+}
+
+static cisv_io_strategy io_choose_strategy(const cisv_parser *p, int fd, size_t size) {
+    FsKind fs = io_fs_kind(fd);
+    if (fs == FS_REMOTE) return CISV_IO_PREAD;
+
+    if (fs == FS_LOCAL && !__atomic_load_n(&io_calibrated, __ATOMIC_ACQUIRE)) {
+        io_calibrate(fd, size);
+    }
+    if (size <= __atomic_load_n(&io_small_file_limit, __ATOMIC_RELAXED)) return CISV_IO_PREAD;
+
+    // Larger than half of RAM: caching it would only evict everything else
+    long pages = sysconf(_SC_PHYS_PAGES);
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (fs == FS_LOCAL && pages > 0 && page_size > 0 &&
+        size > (size_t)pages * (size_t)page_size / 2) {
+        return CISV_IO_DIRECT;
+    }
+
+    if (mmap_window_for(p->mmap_window, size) < size) return CISV_IO_MMAP_LAZY;
+    return CISV_IO_MMAP;
+}
+
+cisv_io_strategy cisv_parser_io_strategy(const cisv_parser *p) {
+    return p ? p->io_used : CISV_IO_AUTO;
+}
+
+const char *cisv_io_strategy_name(cisv_io_strategy strategy) {
+    switch (strategy) {
+        case CISV_IO_MMAP: return "mmap";
+        case CISV_IO_MMAP_LAZY: return "mmap-lazy";
+        case CISV_IO_PREAD: return "pread";
+        case CISV_IO_DIRECT: return "direct";
+        default: return "auto";
+    }
+}
+
+// Read a small file whole into one buffer and parse it like a mapping
+static int parse_file_buffered(cisv_parser *p, size_t size) {
+    uint8_t *buf = malloc(size);
+    if (!buf) return -ENOMEM;
+
+    size_t got = 0;
+    while (got < size) {
+        ssize_t n = pread(p->fd, buf + got, size - got, (off_t)got);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            int err = -errno;
+            free(buf);
+            return err;
+        }
+        if (n == 0) break;
+        got += (size_t)n;
+    }
+
+    parser_reset_input(p);
+    p->cur = buf;
+    p->end = buf + got;
+    p->field_start = p->cur;
+    parse_dispatch(p);
+
+    free(buf);
+    return 0;
+}
+
 int cisv_parser_parse_file(cisv_parser *p, const char *path) {
     if (!p || !path) return -EINVAL;
 
@@ -1580,51 +2384,82 @@ int cisv_parser_parse_file(cisv_parser *p, const char *path) {
         return -errno;
     }
 
+    // Pipes and devices have no size to map: read them instead
+    if (!S_ISREG(st.st_mode)) {
+        int ret = cisv_parser_parse_fd(p, p->fd, NULL);
+        close(p->fd);
+        p->fd = -1;
+        return ret;
+    }
+
     if (st.st_size == 0) {
         close(p->fd);
         p->fd = -1;
         return 0;
     }
 
-    p->size = st.st_size;
-
-    int flags = MAP_PRIVATE;
-#ifdef MAP_HUGETLB
-    if (st.st_size > 2*1024*1024) flags |= MAP_HUGETLB;
-#endif
-#ifdef MAP_POPULATE
-    flags |= MAP_POPULATE;
-#endif
-
-    p->base = (uint8_t*)mmap(NULL, p->size, PROT_READ, flags, p->fd, 0);
+    size_t size = (size_t)st.st_size;
+    cisv_io_strategy strategy = p->io_strategy != CISV_IO_AUTO
+                              ? p->io_strategy : io_choose_strategy(p, p->fd, size);
+    p->io_used = strategy;
 
-#ifdef MAP_HUGETLB
-    if (p->base == MAP_FAILED && (flags & MAP_HUGETLB)) {
-        flags &= ~MAP_HUGETLB;
-        p->base = (uint8_t*)mmap(NULL, p->size, PROT_READ, flags, p->fd, 0);
-    }
+    if (strategy == CISV_IO_PREAD && size <= IO_SMALL_FILE_MAX) {
+        int ret = parse_file_buffered(p, size);
+        close(p->fd);
+        p->fd = -1;
+        return ret;
+    }
+    if (strategy == CISV_IO_PREAD || strategy == CISV_IO_DIRECT) {
+        close(p->fd);
+        p->fd = -1;
+        cisv_read_config rc;
+        cisv_read_config_init(&rc);
+        rc.buffer_size = IO_HUGE_PAGE;
+        rc.direct = strategy == CISV_IO_DIRECT;
+        return cisv_parser_parse_file_read(p, path, &rc);
+    }
+
+    // Larger than the mapping budget: slide a window over the file
+    size_t window = strategy == CISV_IO_MMAP_LAZY ? mmap_window_for(p->mmap_window, size) : size;
+    if (window < size) {
+        int ret = parse_file_windowed(p, size, window);
+        close(p->fd);
+        p->fd = -1;
+        return ret;
+    }
+
+    p->size = size;
+
+    // Regular files cannot be mapped with MAP_HUGETLB (hugetlbfs only);
+    // MADV_HUGEPAGE below asks for huge pages where the filesystem has them
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (strategy == CISV_IO_MMAP) flags |= MAP_POPULATE;
 #endif
 
+    p->base = (uint8_t*)mmap(NULL, p->size, PROT_READ, flags, p->fd, 0);
+
     if (p->base == MAP_FAILED) {
+        // Filesystems that refuse mmap can still be read
+        int ret = errno == ENODEV ? cisv_parser_parse_fd(p, p->fd, NULL) : -errno;
+        p->base = NULL;
+        p->size = 0;
         close(p->fd);
         p->fd = -1;
-        return -errno;
+        return ret;
     }
 
-    madvise(p->base, p->size, MADV_SEQUENTIAL | MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+    if (p->size >= IO_HUGE_PAGE) madvise(p->base, p->size, MADV_HUGEPAGE);
+#endif
+    // Advice values are enumerated, not flags: one call each
+    madvise(p->base, p->size, MADV_SEQUENTIAL);
+    madvise(p->base, p->size, MADV_WILLNEED);
 
+    parser_reset_input(p);
     p->cur = p->base;
     p->end = p->base + p->size;
     p->field_start = p->cur;
-    p->state = S_NORMAL;
-    p->line_num = 0;
-    p->current_row_fields = 0;
-    p->quote_buffer_pos = 0;
-    p->stream_buffer_pos = 0;
-    p->streaming_mode = false;
-    p->current_row_size = 0;
-    p->skip_current_row = false;
-    p->row_is_comment = false;
 
     // Runtime ISA dispatch with scalar fallback.
     parse_dispatch(p);
@@ -1640,1004 +2475,4716 @@ int cisv_parser_parse_file(cisv_parser *p, const char *path) {
     return 0;
 }
 
-// Quote-aware row counting helper
-// Counts actual CSV rows by tracking whether newlines are inside quoted fields
-static size_t count_rows_internal(const uint8_t *data, size_t size, char quote_char) {
-    size_t count = 0;
-    bool in_quote = false;
-    size_t i = 0;
+// =============================================================================
+// Read Pipeline (io_uring with pread()/read() fallback)
+// For inputs that cannot or should not be mmapped. queue_depth aligned
+// buffers are in flight at consecutive offsets; the oldest one is parsed
+// through the streaming path as soon as it completes and is then reissued
+// at the next offset, so parsing buffer N overlaps reading N+1..N+k.
+// =============================================================================
 
-    // Unrolled no-quote fast path (16 bytes/lane) for common datasets.
-    while (!in_quote && i + 16 <= size) {
-        uint64_t word0;
-        uint64_t word1;
-        memcpy(&word0, data + i, sizeof(word0));
-        memcpy(&word1, data + i + 8, sizeof(word1));
+#define READ_DEFAULT_BUFFER (1024 * 1024)
+#define READ_DEFAULT_DEPTH 4
+#define READ_MAX_DEPTH 64
+#define READ_ALIGN 4096
 
-        uint64_t quote_mask0 = swar_has_byte(word0, (uint8_t)quote_char);
-        uint64_t quote_mask1 = swar_has_byte(word1, (uint8_t)quote_char);
-        if (quote_mask0 | quote_mask1) {
-            break;
+// Returned by the io_uring backend when no ring could be set up
+#define READ_URING_UNAVAILABLE 1
+
+void cisv_read_config_init(cisv_read_config *config) {
+    if (!config) return;
+    memset(config, 0, sizeof(*config));
+    config->use_io_uring = true;
+}
+
+// One read buffer of the pipeline
+typedef struct {
+    uint8_t *buf;
+    uint64_t offset;          // File offset of buf[0]
+    size_t skip;              // Bytes at buf[0] that precede the wanted data
+    size_t len;               // Bytes requested
+    size_t expect;            // Bytes of file data wanted after skip
+    struct iovec iov;         // Must stay valid while the read is in flight
+    int result;               // Completion result (bytes or -errno)
+    bool done;
+} ReadSlot;
+
+// Size a request for up to want bytes at offset against the file size
+// snapshot and the buffer size. O_DIRECT needs aligned offsets and lengths,
+// so the request starts at the aligned offset at or below offset (the skip
+// bytes before it were parsed already) and its length is rounded up; the
+// kernel simply does not return the excess past the end of the file.
+static inline void read_slot_prepare(ReadSlot *s, uint64_t offset, size_t want,
+                                     size_t bufsize, uint64_t size, bool stream) {
+    s->skip = stream ? 0 : (size_t)(offset & (READ_ALIGN - 1));
+    s->offset = offset - s->skip;
+    s->expect = want < bufsize - s->skip ? want : bufsize - s->skip;
+    s->len = bufsize;
+    if (!stream) {
+        if (size - offset < s->expect) s->expect = (size_t)(size - offset);
+        s->len = (s->skip + s->expect + READ_ALIGN - 1) & ~(size_t)(READ_ALIGN - 1);
+    }
+    s->done = false;
+}
+
+// File data bytes a completed request returned past its skip
+static inline size_t read_slot_got(const ReadSlot *s, size_t result) {
+    if (result <= s->skip) return 0;
+    result -= s->skip;
+    return result > s->expect ? s->expect : result;
+}
+
+#ifdef CISV_HAVE_IO_URING
+
+// Minimal io_uring: one SQ/CQ pair driven with the raw syscalls
+typedef struct {
+    int fd;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sq_ring;
+    size_t sq_ring_len;
+    void *cq_ring;
+    size_t cq_ring_len;
+    size_t sqes_len;
+    unsigned features;
+    unsigned to_submit;       // SQEs queued but not yet submitted
+} UringRing;
+
+static void uring_free(UringRing *r) {
+    if (r->sqes) munmap(r->sqes, r->sqes_len);
+    if (r->cq_ring && r->cq_ring != r->sq_ring) munmap(r->cq_ring, r->cq_ring_len);
+    if (r->sq_ring) munmap(r->sq_ring, r->sq_ring_len);
+    if (r->fd >= 0) close(r->fd);
+}
+
+static int uring_init(UringRing *r, unsigned entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    memset(r, 0, sizeof(*r));
+    r->fd = -1;
+
+    int fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0) return -errno;
+    r->fd = fd;
+    r->features = params.features;
+
+    r->sq_ring_len = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    r->cq_ring_len = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single) {
+        if (r->cq_ring_len > r->sq_ring_len) r->sq_ring_len = r->cq_ring_len;
+        r->cq_ring_len = r->sq_ring_len;
+    }
+
+    r->sq_ring = mmap(NULL, r->sq_ring_len, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd, IORING_OFF_SQ_RING);
+    if (r->sq_ring == MAP_FAILED) {
+        r->sq_ring = NULL;
+        goto fail;
+    }
+    if (single) {
+        r->cq_ring = r->sq_ring;
+    } else {
+        r->cq_ring = mmap(NULL, r->cq_ring_len, PROT_READ | PROT_WRITE,
+                          MAP_SHARED, fd, IORING_OFF_CQ_RING);
+        if (r->cq_ring == MAP_FAILED) {
+            r->cq_ring = NULL;
+            goto fail;
         }
+    }
+    r->sqes_len = params.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = mmap(NULL, r->sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED,
+                   fd, IORING_OFF_SQES);
+    if (r->sqes == MAP_FAILED) {
+        r->sqes = NULL;
+        goto fail;
+    }
+
+    uint8_t *sq = r->sq_ring;
+    uint8_t *cq = r->cq_ring;
+    r->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    r->sq_mask = (unsigned *)(sq + params.sq_off.ring_mask);
+    r->sq_array = (unsigned *)(sq + params.sq_off.array);
+    r->cq_head = (unsigned *)(cq + params.cq_off.head);
+    r->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    r->cq_mask = (unsigned *)(cq + params.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+    return 0;
 
-        uint64_t nl_mask0 = swar_has_byte(word0, '\n');
-        uint64_t nl_mask1 = swar_has_byte(word1, '\n');
-        count += (size_t)__builtin_popcountll(nl_mask0);
-        count += (size_t)__builtin_popcountll(nl_mask1);
-        i += 16;
+fail:;
+    int err = -errno;
+    uring_free(r);
+    return err;
+}
+
+// Queue a readv of iov at offset; user_data identifies the slot
+static inline void uring_queue_readv(UringRing *r, int fd, const struct iovec *iov,
+                                     uint64_t offset, uint64_t user_data) {
+    unsigned tail = *r->sq_tail;
+    unsigned idx = tail & *r->sq_mask;
+    struct io_uring_sqe *sqe = &r->sqes[idx];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)iov;
+    sqe->len = 1;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+
+    r->sq_array[idx] = idx;
+    __atomic_store_n(r->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    r->to_submit++;
+}
+
+// Submit queued SQEs and optionally wait for a completion
+static int uring_enter(UringRing *r, unsigned min_complete) {
+    for (;;) {
+        long ret = syscall(__NR_io_uring_enter, r->fd, r->to_submit, min_complete,
+                           min_complete ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if (ret < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        r->to_submit -= (unsigned)ret;
+        return 0;
     }
+}
 
-    // SWAR-accelerated quote-aware counting for remaining bytes.
-    while (i + 8 <= size) {
-        uint64_t word;
-        memcpy(&word, data + i, sizeof(word));
+// user_data of cancel requests, whose completions carry no slot
+#define URING_CANCEL_TAG UINT64_MAX
 
-        if (in_quote) {
-            // While in quoted mode, only quote bytes can change state.
-            uint64_t quote_mask = swar_has_byte(word, (uint8_t)quote_char);
-            if (!quote_mask) {
-                i += 8;
-                continue;
-            }
-        } else {
-            uint64_t quote_mask = swar_has_byte(word, (uint8_t)quote_char);
-            uint64_t nl_mask = swar_has_byte(word, '\n');
+// Ask the kernel to cancel the request queued with user_data
+static inline void uring_queue_cancel(UringRing *r, uint64_t user_data) {
+    unsigned tail = *r->sq_tail;
+    unsigned idx = tail & *r->sq_mask;
+    struct io_uring_sqe *sqe = &r->sqes[idx];
 
-            // Fast path: no quotes in this lane, count all newlines via popcount.
-            if (!quote_mask) {
-                count += (size_t)__builtin_popcountll(nl_mask);
-                i += 8;
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = user_data;
+    sqe->user_data = URING_CANCEL_TAG;
+
+    r->sq_array[idx] = idx;
+    __atomic_store_n(r->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    r->to_submit++;
+}
+
+// Pop one completion if available
+static inline bool uring_reap(UringRing *r, uint64_t *user_data, int *res) {
+    unsigned head = *r->cq_head;
+    if (head == __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE)) return false;
+
+    const struct io_uring_cqe *cqe = &r->cqes[head & *r->cq_mask];
+    *user_data = cqe->user_data;
+    *res = cqe->res;
+    __atomic_store_n(r->cq_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static inline void read_slot_submit(UringRing *r, int fd, ReadSlot *s, size_t index,
+                                    bool stream) {
+    s->iov.iov_base = s->buf;
+    s->iov.iov_len = s->len;
+    s->done = false;
+    // Streams read at the current file position
+    uring_queue_readv(r, fd, &s->iov, stream ? (uint64_t)-1 : s->offset, index);
+}
+
+// Completions of read requests (cancel completions are skipped)
+static inline bool uring_reap_read(UringRing *r, ReadSlot *slots, size_t *inflight) {
+    uint64_t index;
+    int res;
+    bool any = false;
+    while (uring_reap(r, &index, &res)) {
+        if (index == URING_CANCEL_TAG) continue;
+        slots[index].result = res;
+        slots[index].done = true;
+        (*inflight)--;
+        any = true;
+    }
+    return any;
+}
+
+// Attempts to wait out in-flight reads before their buffers are given up
+#define URING_DRAIN_RETRIES 100
+
+// Reads until the end of input, parsing each buffer as it completes.
+// *keep_buffers is set when reads could still be in flight on return, so the
+// caller must not free or reuse the slot buffers.
+static int read_pipeline_uring(cisv_parser *p, int fd, bool stream, uint64_t size,
+                               size_t bufsize, ReadSlot *slots, size_t depth,
+                               bool *keep_buffers) {
+    UringRing ring;
+    if (uring_init(&ring, (unsigned)depth) < 0) return READ_URING_UNAVAILABLE;
+    if (stream && !(ring.features & IORING_FEAT_RW_CUR_POS)) {
+        uring_free(&ring);
+        return READ_URING_UNAVAILABLE;
+    }
+
+    uint64_t next_offset = 0;
+    size_t inflight = 0;      // Submitted, not yet completed
+    size_t queued = 0;        // Submitted, not yet parsed
+    size_t head = 0;
+    int err = 0;
+
+    // done is false exactly while a slot's read is in flight
+    for (size_t i = 0; i < depth; i++) slots[i].done = true;
+    for (size_t i = 0; i < depth && (stream || next_offset < size); i++) {
+        read_slot_prepare(&slots[i], next_offset, bufsize, bufsize, size, stream);
+        read_slot_submit(&ring, fd, &slots[i], i, stream);
+        next_offset += bufsize;
+        inflight++;
+        queued++;
+    }
+
+    while (queued > 0) {
+        ReadSlot *s = &slots[head];
+
+        // Wait for the oldest buffer; later ones complete in the background
+        while (!s->done) {
+            uring_reap_read(&ring, slots, &inflight);
+            if (s->done) break;
+            err = uring_enter(&ring, 1);
+            if (err < 0) goto drain;
+        }
+
+        if (s->result < 0) {
+            if (s->result == -EINTR) {
+                read_slot_submit(&ring, fd, s, head, stream);
+                inflight++;
                 continue;
             }
+            err = s->result;
+            goto drain;
         }
 
-        // Slow path for mixed/special lanes.
-        for (size_t j = 0; j < 8; j++) {
-            uint8_t c = data[i + j];
-            if (in_quote) {
-                if (c == (uint8_t)quote_char) {
-                    // Look ahead for escaped quote ("")
-                    if (i + j + 1 < size && data[i + j + 1] == (uint8_t)quote_char) {
-                        j++;
-                    } else {
-                        in_quote = false;
-                    }
-                }
-            } else {
-                if (c == '\n') {
-                    count++;
-                } else if (c == (uint8_t)quote_char) {
-                    in_quote = true;
-                }
-            }
+        size_t got = read_slot_got(s, (size_t)s->result);
+        if (got == 0) break;  // End of input
+        err = parser_write_buffered(p, s->buf + s->skip, got);
+        if (err < 0) goto drain;
+
+        if (!stream && got < s->expect) {
+            // Short read before the end: fetch the rest of this range next
+            read_slot_prepare(s, s->offset + s->skip + got, s->expect - got, bufsize,
+                              size, false);
+            read_slot_submit(&ring, fd, s, head, false);
+            inflight++;
+            continue;
         }
-        i += 8;
-    }
 
-    // Scalar tail
-    for (; i < size; i++) {
-        uint8_t c = data[i];
-        if (in_quote) {
-            if (c == (uint8_t)quote_char) {
-                // Look ahead for escaped quote ("")
-                if (i + 1 < size && data[i + 1] == (uint8_t)quote_char) {
-                    i++;  // Skip escaped quote
-                } else {
-                    in_quote = false;
-                }
-            }
-        } else {
-            if (c == '\n') {
-                count++;
-            } else if (c == (uint8_t)quote_char) {
-                in_quote = true;
-            }
+        queued--;
+        if (stream || next_offset < size) {
+            read_slot_prepare(s, next_offset, bufsize, bufsize, size, stream);
+            read_slot_submit(&ring, fd, s, head, stream);
+            next_offset += bufsize;
+            inflight++;
+            queued++;
+        }
+        head = (head + 1) % depth;
+    }
+
+drain:
+    // Buffers may not be released while the kernel can still write them.
+    // Reads still in flight are cancelled, since a stream read may otherwise
+    // wait for input forever (only once all of them are submitted, so the SQ
+    // has room), and every completion is waited for. If the ring keeps
+    // failing, the buffers are kept rather than freed under the kernel.
+    if (inflight > 0 && ring.to_submit == 0) {
+        for (size_t i = 0; i < depth; i++) {
+            if (!slots[i].done) uring_queue_cancel(&ring, i);
         }
     }
-
-    // If file doesn't end with newline, count the last row
-    if (size > 0 && data[size - 1] != '\n') {
-        count++;
+    for (int failures = 0; inflight > 0;) {
+        uring_reap_read(&ring, slots, &inflight);
+        if (inflight == 0) break;
+        if (uring_enter(&ring, 1) < 0) {
+            if (++failures >= URING_DRAIN_RETRIES) {
+                *keep_buffers = true;
+                break;
+            }
+            sched_yield();
+        }
     }
-
-    return count;
+    uring_free(&ring);
+    return err;
 }
 
-// Quote-aware row counting
-size_t cisv_parser_count_rows(const char *path) {
-    int fd = open(path, O_RDONLY);
-    if (fd < 0) return 0;
-
-    struct stat st;
-    if (fstat(fd, &st) < 0) {
-        close(fd);
-        return 0;
+#endif // CISV_HAVE_IO_URING
+
+// Page-aligned (for O_DIRECT) read buffer; buffers of a huge page or more
+// are anonymous mappings backed by transparent huge pages, so streaming a
+// large file through them does not walk thousands of 4 KiB TLB entries.
+static uint8_t *read_buffer_alloc(size_t size) {
+    if (size >= IO_HUGE_PAGE) {
+        void *buf = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buf == MAP_FAILED) return NULL;
+#ifdef MADV_HUGEPAGE
+        madvise(buf, size, MADV_HUGEPAGE);
+#endif
+        return buf;
     }
+    void *buf = NULL;
+    return posix_memalign(&buf, READ_ALIGN, size) == 0 ? buf : NULL;
+}
 
-    if (st.st_size == 0) {
-        close(fd);
-        return 0;
+static void read_buffer_free(uint8_t *buf, size_t size) {
+    if (!buf) return;
+    if (size >= IO_HUGE_PAGE) {
+        munmap(buf, size);
+    } else {
+        free(buf);
     }
+}
 
-    int flags = MAP_PRIVATE;
-#ifdef MAP_POPULATE
-    flags |= MAP_POPULATE;
-#endif
+// Synchronous fallback: one buffer, pread() for files, read() for streams
+static int read_pipeline_sync(cisv_parser *p, int fd, bool stream, uint64_t size,
+                              size_t bufsize, ReadSlot *slot) {
+    uint64_t offset = 0;
+
+    while (stream || offset < size) {
+        read_slot_prepare(slot, offset, bufsize, bufsize, size, stream);
+        ssize_t n = stream ? read(fd, slot->buf, slot->len)
+                           : pread(fd, slot->buf, slot->len, (off_t)slot->offset);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
 
-    uint8_t *base = (uint8_t*)mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
-    if (base == MAP_FAILED) {
-        close(fd);
-        return 0;
+        size_t got = read_slot_got(slot, (size_t)n);
+        if (got == 0) break;
+        int err = parser_write_buffered(p, slot->buf + slot->skip, got);
+        if (err < 0) return err;
+        offset += got;
     }
+    return 0;
+}
 
-    madvise(base, st.st_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+int cisv_parser_parse_fd(cisv_parser *p, int fd, const cisv_read_config *config) {
+    if (!p || fd < 0) return -EINVAL;
 
-    size_t count = count_rows_internal(base, st.st_size, '"');
+    cisv_read_config defaults;
+    if (!config) {
+        cisv_read_config_init(&defaults);
+        config = &defaults;
+    }
 
-    munmap(base, st.st_size);
-    close(fd);
-    return count;
-}
+    struct stat st;
+    if (fstat(fd, &st) < 0) return -errno;
 
-size_t cisv_parser_count_rows_with_config(const char *path, const cisv_config *config) {
-    if (!config) return cisv_parser_count_rows(path);
+    bool stream = !S_ISREG(st.st_mode);
+    uint64_t size = stream ? 0 : (uint64_t)st.st_size;
 
-    int fd = open(path, O_RDONLY);
-    if (fd < 0) return 0;
+    size_t bufsize = config->buffer_size ? config->buffer_size : READ_DEFAULT_BUFFER;
+    if (bufsize > SIZE_MAX - READ_ALIGN) return -EINVAL;
+    bufsize = (bufsize + READ_ALIGN - 1) & ~(size_t)(READ_ALIGN - 1);
 
-    struct stat st;
-    if (fstat(fd, &st) < 0) {
-        close(fd);
-        return 0;
-    }
+    // Streams have no offsets, so only one read can be in flight
+    size_t depth = config->queue_depth > 0 ? (size_t)config->queue_depth : READ_DEFAULT_DEPTH;
+    if (depth > READ_MAX_DEPTH) depth = READ_MAX_DEPTH;
+    if (stream) depth = 1;
 
-    if (st.st_size == 0) {
-        close(fd);
-        return 0;
+    if (!stream) {
+#ifdef POSIX_FADV_SEQUENTIAL
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
     }
 
-    int flags = MAP_PRIVATE;
-#ifdef MAP_POPULATE
-    flags |= MAP_POPULATE;
+#ifdef O_DIRECT
+    int fl = fcntl(fd, F_GETFL);
+    p->io_used = fl >= 0 && (fl & O_DIRECT) ? CISV_IO_DIRECT : CISV_IO_PREAD;
+#else
+    p->io_used = CISV_IO_PREAD;
 #endif
 
-    uint8_t *base = (uint8_t*)mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
-    if (base == MAP_FAILED) {
-        close(fd);
-        return 0;
+    ReadSlot *slots = calloc(depth, sizeof(ReadSlot));
+    if (!slots) return -ENOMEM;
+    int ret = 0;
+    for (size_t i = 0; i < depth; i++) {
+        slots[i].buf = read_buffer_alloc(bufsize);
+        if (!slots[i].buf) {
+            ret = -ENOMEM;
+            goto done;
+        }
     }
 
-    madvise(base, st.st_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+    parser_reset_input(p);
+    p->streaming_mode = true;
 
-    size_t count = count_rows_internal(base, st.st_size, config->quote);
+    ret = READ_URING_UNAVAILABLE;
+    bool keep_buffers = false;
+#ifdef CISV_HAVE_IO_URING
+    if (config->use_io_uring) {
+        ret = read_pipeline_uring(p, fd, stream, size, bufsize, slots, depth, &keep_buffers);
+    }
+#endif
+    if (ret == READ_URING_UNAVAILABLE) {
+        ret = read_pipeline_sync(p, fd, stream, size, bufsize, &slots[0]);
+    }
+    if (ret == 0) cisv_parser_end(p);
+    if (keep_buffers) {
+        // The kernel may still write into them: leak rather than free
+        free(slots);
+        return ret;
+    }
 
-    munmap(base, st.st_size);
-    close(fd);
-    return count;
+done:
+    for (size_t i = 0; i < depth; i++) read_buffer_free(slots[i].buf, bufsize);
+    free(slots);
+    return ret;
 }
 
-int cisv_parser_write(cisv_parser *p, const uint8_t *chunk, size_t len) {
-    if (!p || (!chunk && len > 0)) return -EINVAL;
+int cisv_parser_parse_file_read(cisv_parser *p, const char *path,
+                                const cisv_read_config *config) {
+    if (!p || !path) return -EINVAL;
 
-    // Enable streaming mode - fields may span chunks
-    p->streaming_mode = true;
+    int fd = -1;
+#ifdef O_DIRECT
+    if (config && config->direct) {
+        fd = open(path, O_RDONLY | O_DIRECT);
+        // Filesystems without O_DIRECT support (e.g. tmpfs) read buffered
+        if (fd < 0 && errno != EINVAL) return -errno;
+    }
+#endif
+    if (fd < 0) fd = open(path, O_RDONLY);
+    if (fd < 0) return -errno;
 
-    p->cur = chunk;
-    p->end = chunk + len;
-    p->field_start = p->cur;
+    int ret = cisv_parser_parse_fd(p, fd, config);
+    close(fd);
+    return ret;
+}
 
-    parse_dispatch(p);
+// =============================================================================
+// Compressed Input (gzip via zlib, zstd via libzstd)
+// Decoder threads fill a ring of output buffers that the calling thread
+// parses in order through the streaming path, so inflating buffer N+1
+// overlaps parsing buffer N. Inputs made of independently decodable blocks
+// (BGZF gzip, zstd frames with known sizes) are split into units that a pool
+// of decoders inflates in parallel; everything else has one decoder thread.
+// =============================================================================
 
-    // After parsing, buffer any partial unquoted field for next chunk
-    // (quoted fields are already handled by quote_buffer)
-    if (p->state == S_NORMAL && p->field_start && p->field_start < p->cur) {
-        // We have a partial field - buffer it for the next write() call
-        size_t partial_len = p->cur - p->field_start;
-        if (partial_len > 0) {
-            append_to_stream_buffer(p, p->field_start, partial_len);
+#define DECOMP_CHUNK ((size_t)1 << 20)       // Output per ring slot / unit target
+#define DECOMP_MAX_THREADS 64
+#define DECOMP_MAX_UNIT ((size_t)64 << 20)   // Largest zstd frame decoded as one unit
+
+cisv_compression cisv_detect_compression(const uint8_t *data, size_t len) {
+    if (!data) return CISV_COMPRESSION_NONE;
+    if (len >= 2 && data[0] == 0x1f && data[1] == 0x8b) return CISV_COMPRESSION_GZIP;
+    if (len >= 4) {
+        uint32_t magic = (uint32_t)data[0] | (uint32_t)data[1] << 8 |
+                         (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24;
+        // Regular frame, or a skippable frame (pzstd and seekable zstd lead with one)
+        if (magic == 0xFD2FB528u || (magic & 0xFFFFFFF0u) == 0x184D2A50u) {
+            return CISV_COMPRESSION_ZSTD;
         }
     }
-
-    return 0;
+    return CISV_COMPRESSION_NONE;
 }
 
-void cisv_parser_end(cisv_parser *p) {
-    if (!p) return;
+// Input of a streaming decoder: a mapped range, or an fd read in chunks
+typedef struct {
+    const uint8_t *data;      // Unread input
+    size_t len;
+    int fd;                   // -1: data is all there is
+    uint8_t *buf;             // fd mode read buffer
+    bool eof;
+} DecompInput;
 
-    if (p->streaming_mode) {
-        if (p->state == S_NORMAL && p->stream_buffer_pos > 0) {
-            yield_stream_buffer_field(p);
-        } else if (p->state == S_QUOTED && p->quote_buffer_pos > 0) {
-            if (p->ecb) {
-                p->ecb(p->user, p->line_num, "Unterminated quoted field at EOF");
-            }
-            yield_quoted_field(p);
-        }
-        if (p->current_row_fields > 0) {
-            yield_row(p);
+static int decomp_input_refill(DecompInput *in) {
+    if (in->fd < 0) {
+        in->eof = true;
+        return 0;
+    }
+    for (;;) {
+        ssize_t n = read(in->fd, in->buf, DECOMP_CHUNK);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
         }
-        p->streaming_mode = false;
-        return;
+        in->data = in->buf;
+        in->len = (size_t)n;
+        in->eof = n == 0;
+        return 0;
     }
+}
 
-    if (p->state == S_NORMAL && p->field_start && p->field_start < p->cur) {
-        yield_field(p, p->field_start, p->cur);
-    } else if (p->state == S_QUOTED && p->quote_buffer_pos > 0) {
-        yield_quoted_field(p);
+// One decoder per thread; CISV_COMPRESSION_NONE copies input through
+typedef struct {
+    cisv_compression format;
+    bool frame_open;          // Input ended here would truncate a member/frame
+#ifdef CISV_HAVE_ZLIB
+    z_stream zs;
+    bool zs_ready;
+#endif
+#ifdef CISV_HAVE_ZSTD
+    ZSTD_DCtx *dctx;
+#endif
+} Decoder;
+
+static int decoder_init(Decoder *d, cisv_compression format) {
+    memset(d, 0, sizeof(*d));
+    d->format = format;
+    switch (format) {
+        case CISV_COMPRESSION_NONE:
+            return 0;
+#ifdef CISV_HAVE_ZLIB
+        case CISV_COMPRESSION_GZIP:
+            // 16 + MAX_WBITS: expect the gzip wrapper
+            if (inflateInit2(&d->zs, 16 + MAX_WBITS) != Z_OK) return -ENOMEM;
+            d->zs_ready = true;
+            return 0;
+#endif
+#ifdef CISV_HAVE_ZSTD
+        case CISV_COMPRESSION_ZSTD:
+            d->dctx = ZSTD_createDCtx();
+            return d->dctx ? 0 : -ENOMEM;
+#endif
+        default:
+            return -ENOTSUP;
     }
-    if (p->current_row_fields > 0) {
-        yield_row(p);
+}
+
+static void decoder_free(Decoder *d) {
+#ifdef CISV_HAVE_ZLIB
+    if (d->zs_ready) inflateEnd(&d->zs);
+#endif
+#ifdef CISV_HAVE_ZSTD
+    if (d->dctx) ZSTD_freeDCtx(d->dctx);
+#endif
+    (void)d;
+}
+
+// Decode from in into out[0..cap), advancing in and adding to *produced.
+// Returns 0 or -EBADMSG on corrupt input.
+static int decoder_step(Decoder *d, DecompInput *in, uint8_t *out, size_t cap, size_t *produced) {
+    switch (d->format) {
+#ifdef CISV_HAVE_ZLIB
+        case CISV_COMPRESSION_GZIP: {
+            z_stream *zs = &d->zs;
+            if (!d->frame_open) {
+                // Concatenated members form one stream; anything else after
+                // the last member (e.g. zero padding) is ignored like gzip(1)
+                if (in->data[0] != 0x1f) {
+                    in->data += in->len;
+                    in->len = 0;
+                    return 0;
+                }
+                inflateReset(zs);
+                d->frame_open = true;
+            }
+            zs->next_in = (Bytef *)in->data;
+            zs->avail_in = in->len > UINT_MAX ? UINT_MAX : (uInt)in->len;
+            zs->next_out = out;
+            zs->avail_out = cap > UINT_MAX ? UINT_MAX : (uInt)cap;
+            int rc = inflate(zs, Z_NO_FLUSH);
+            size_t used = (size_t)(zs->next_in - in->data);
+            in->data += used;
+            in->len -= used;
+            *produced += (size_t)(zs->next_out - out);
+            if (rc == Z_STREAM_END) {
+                d->frame_open = false;
+            } else if (rc != Z_OK && rc != Z_BUF_ERROR) {
+                return -EBADMSG;
+            }
+            return 0;
+        }
+#endif
+#ifdef CISV_HAVE_ZSTD
+        case CISV_COMPRESSION_ZSTD: {
+            ZSTD_inBuffer ib = { in->data, in->len, 0 };
+            ZSTD_outBuffer ob = { out, cap, 0 };
+            size_t rc = ZSTD_decompressStream(d->dctx, &ob, &ib);
+            if (ZSTD_isError(rc)) return -EBADMSG;
+            in->data += ib.pos;
+            in->len -= ib.pos;
+            *produced += ob.pos;
+            d->frame_open = rc != 0;
+            return 0;
+        }
+#endif
+        default: {
+            size_t n = in->len < cap ? in->len : cap;
+            memcpy(out, in->data, n);
+            in->data += n;
+            in->len -= n;
+            *produced += n;
+            return 0;
+        }
     }
 }
 
-int cisv_parser_get_line_number(const cisv_parser *p) {
-    return p ? p->line_num : 0;
+// Decode until out[0..cap) is full or the input ends; *len = bytes produced
+static int decoder_fill(Decoder *d, DecompInput *in, uint8_t *out, size_t cap, size_t *len) {
+    *len = 0;
+    while (*len < cap) {
+        if (in->len == 0 && !in->eof) {
+            int err = decomp_input_refill(in);
+            if (err < 0) return err;
+            continue;
+        }
+        if (in->len == 0 && !d->frame_open) break;
+
+        size_t in_before = in->len, out_before = *len;
+        int err = decoder_step(d, in, out + *len, cap - *len, len);
+        if (err < 0) return err;
+        // No progress with room left: corrupt, or input ended inside a frame
+        if (in->len == in_before && *len == out_before) {
+            return -EBADMSG;
+        }
+    }
+    return 0;
 }
 
-// =============================================================================
-// Parallel Chunk Processing Implementation (1 Billion Row Challenge technique)
-// =============================================================================
+// One output buffer of the ring
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t cap;
+    size_t seq;               // Unit held once ready
+    bool ready;
+} DecompSlot;
 
-cisv_mmap_file_t *cisv_mmap_open(const char *path) {
-    int fd = open(path, O_RDONLY);
-    if (fd < 0) return NULL;
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t filled;    // A slot became ready, or the input ended
+    pthread_cond_t drained;   // The parser released a slot
+    DecompSlot *slots;
+    size_t nslots;
+    size_t next_read;         // Next unit the parser consumes
+    size_t next_unit;         // Next unit a decoder claims (parallel mode)
+    size_t total;             // Units in the input (SIZE_MAX while unknown)
+    int error;                // First error, -errno
+
+    cisv_compression format;
+    DecompInput input;        // Streaming mode
+    const uint8_t *src;       // Parallel mode: mapped input ...
+    size_t *unit_start;       // ... unit i is src[unit_start[i] .. unit_start[i + 1])
+    size_t *unit_size;        // Decoded size of unit i
+    size_t unit_count;
+} DecompRing;
+
+// Wait until unit seq may fill its slot; NULL once the ring failed
+static DecompSlot *ring_acquire(DecompRing *r, size_t seq) {
+    pthread_mutex_lock(&r->lock);
+    while (!r->error && seq >= r->next_read + r->nslots) {
+        pthread_cond_wait(&r->drained, &r->lock);
+    }
+    DecompSlot *s = r->error ? NULL : &r->slots[seq % r->nslots];
+    pthread_mutex_unlock(&r->lock);
+    return s;
+}
 
-    struct stat st;
-    if (fstat(fd, &st) < 0) {
-        close(fd);
-        return NULL;
+static void ring_publish(DecompRing *r, DecompSlot *s, size_t seq) {
+    pthread_mutex_lock(&r->lock);
+    s->seq = seq;
+    s->ready = true;
+    pthread_cond_broadcast(&r->filled);
+    pthread_mutex_unlock(&r->lock);
+}
+
+static void ring_fail(DecompRing *r, int err) {
+    pthread_mutex_lock(&r->lock);
+    if (!r->error) r->error = err;
+    pthread_cond_broadcast(&r->filled);
+    pthread_cond_broadcast(&r->drained);
+    pthread_mutex_unlock(&r->lock);
+}
+
+static bool slot_reserve(DecompSlot *s, size_t cap) {
+    if (s->cap >= cap) return true;
+    uint8_t *buf = realloc(s->buf, cap);
+    if (!buf) return false;
+    s->buf = buf;
+    s->cap = cap;
+    return true;
+}
+
+// Streaming mode: one decoder cuts the output into DECOMP_CHUNK units
+static void *decomp_stream_worker(void *arg) {
+    DecompRing *r = arg;
+    Decoder d;
+    int err = decoder_init(&d, r->format);
+    size_t seq = 0;
+
+    while (err == 0) {
+        DecompSlot *s = ring_acquire(r, seq);
+        if (!s) break;
+        if (!slot_reserve(s, DECOMP_CHUNK)) {
+            err = -ENOMEM;
+            break;
+        }
+        err = decoder_fill(&d, &r->input, s->buf, DECOMP_CHUNK, &s->len);
+        if (err < 0 || s->len == 0) break;
+        ring_publish(r, s, seq++);
     }
+    decoder_free(&d);
 
-    if (st.st_size == 0) {
-        close(fd);
-        errno = EINVAL;
-        return NULL;
+    if (err < 0) {
+        ring_fail(r, err);
+    } else {
+        pthread_mutex_lock(&r->lock);
+        r->total = seq;
+        pthread_cond_broadcast(&r->filled);
+        pthread_mutex_unlock(&r->lock);
     }
+    return NULL;
+}
 
-    int flags = MAP_PRIVATE;
-#ifdef MAP_POPULATE
-    flags |= MAP_POPULATE;
-#endif
+// Parallel mode: decoders claim whole units in order
+static void *decomp_unit_worker(void *arg) {
+    DecompRing *r = arg;
+    Decoder d;
+    int err = decoder_init(&d, r->format);
+
+    while (err == 0) {
+        pthread_mutex_lock(&r->lock);
+        size_t seq = !r->error && r->next_unit < r->unit_count ? r->next_unit++ : SIZE_MAX;
+        pthread_mutex_unlock(&r->lock);
+        if (seq == SIZE_MAX) break;
+
+        DecompSlot *s = ring_acquire(r, seq);
+        if (!s) break;
+        // One spare byte: the buffer never fills, so trailers get consumed
+        if (!slot_reserve(s, r->unit_size[seq] + 1)) {
+            err = -ENOMEM;
+            break;
+        }
 
-    uint8_t *data = (uint8_t*)mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
-    if (data == MAP_FAILED) {
-        close(fd);
-        return NULL;
+        DecompInput in = { r->src + r->unit_start[seq],
+                           r->unit_start[seq + 1] - r->unit_start[seq], -1, NULL, true };
+        err = decoder_fill(&d, &in, s->buf, r->unit_size[seq] + 1, &s->len);
+        // The sizes the split relied on must match what the data decodes to
+        if (err == 0 && (s->len != r->unit_size[seq] || in.len > 0 || d.frame_open)) {
+            err = -EBADMSG;
+        }
+        if (err == 0) ring_publish(r, s, seq);
     }
+    decoder_free(&d);
 
-    // Advise kernel for sequential access
-    madvise(data, st.st_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+    if (err < 0) ring_fail(r, err);
+    return NULL;
+}
 
-    cisv_mmap_file_t *file = malloc(sizeof(cisv_mmap_file_t));
-    if (!file) {
-        munmap(data, st.st_size);
-        close(fd);
-        return NULL;
+// Compressed and decoded size of the independent block at p, or false.
+// BGZF (bgzip/htslib) stores the member size in a "BC" extra subfield and
+// every gzip member ends with its decoded size mod 2^32.
+static bool gzip_next_block(const uint8_t *p, size_t len, size_t *csize, size_t *dsize) {
+    if (len < 18 || p[0] != 0x1f || p[1] != 0x8b || p[2] != 8 || !(p[3] & 4)) return false;
+    size_t xlen = (size_t)p[10] | (size_t)p[11] << 8;
+    for (size_t i = 12; i + 4 <= 12 + xlen && i + 4 <= len; ) {
+        size_t slen = (size_t)p[i + 2] | (size_t)p[i + 3] << 8;
+        if (p[i] == 'B' && p[i + 1] == 'C' && slen == 2 && i + 6 <= len) {
+            size_t bsize = ((size_t)p[i + 4] | (size_t)p[i + 5] << 8) + 1;
+            if (bsize > len || bsize < 12 + xlen + 8) return false;
+            const uint8_t *t = p + bsize - 4;
+            *csize = bsize;
+            *dsize = (size_t)t[0] | (size_t)t[1] << 8 | (size_t)t[2] << 16 | (size_t)t[3] << 24;
+            return true;
+        }
+        i += 4 + slen;
     }
+    return false;
+}
 
-    file->data = data;
-    file->size = st.st_size;
-    file->fd = fd;
-
-    return file;
+#ifdef CISV_HAVE_ZSTD
+static bool zstd_next_block(const uint8_t *p, size_t len, size_t *csize, size_t *dsize) {
+    size_t c = ZSTD_findFrameCompressedSize(p, len);
+    if (ZSTD_isError(c)) return false;
+    unsigned long long n = ZSTD_getFrameContentSize(p, len);
+    if (n == ZSTD_CONTENTSIZE_UNKNOWN || n == ZSTD_CONTENTSIZE_ERROR || n > DECOMP_MAX_UNIT) {
+        return false;
+    }
+    *csize = c;
+    *dsize = (size_t)n;
+    return true;
 }
+#endif
 
-void cisv_mmap_close(cisv_mmap_file_t *file) {
-    if (!file) return;
-    if (file->data) munmap(file->data, file->size);
-    if (file->fd >= 0) close(file->fd);
-    free(file);
+// Split mapped input into units of about DECOMP_CHUNK decoded bytes. Fails
+// (streaming mode) when the format gives no block boundaries or there is
+// only one unit.
+static bool decomp_split_units(DecompRing *r, const uint8_t *src, size_t len) {
+    size_t cap = 0, count = 0, off = 0, unit_size = 0;
+    while (off < len) {
+        size_t csize = 0, dsize = 0;
+        bool ok = false;
+        if (r->format == CISV_COMPRESSION_GZIP) ok = gzip_next_block(src + off, len - off, &csize, &dsize);
+#ifdef CISV_HAVE_ZSTD
+        if (r->format == CISV_COMPRESSION_ZSTD) ok = zstd_next_block(src + off, len - off, &csize, &dsize);
+#endif
+        if (!ok) goto fail;
+
+        // Start a new unit when this block would overfill the current one
+        if (count == 0 || (unit_size > 0 && unit_size + dsize > DECOMP_CHUNK)) {
+            if (count + 2 > cap) {
+                cap = cap ? cap * 2 : 64;
+                size_t *starts = realloc(r->unit_start, cap * sizeof(size_t));
+                if (starts) r->unit_start = starts;
+                size_t *sizes = realloc(r->unit_size, cap * sizeof(size_t));
+                if (sizes) r->unit_size = sizes;
+                if (!starts || !sizes) goto fail;
+            }
+            r->unit_start[count] = off;
+            r->unit_size[count] = 0;
+            count++;
+            unit_size = 0;
+        }
+        unit_size += dsize;
+        r->unit_size[count - 1] = unit_size;
+        off += csize;
+    }
+    if (count < 2) goto fail;
+    r->unit_start[count] = len;
+    r->unit_count = count;
+    return true;
+
+fail:
+    free(r->unit_start);
+    free(r->unit_size);
+    r->unit_start = NULL;
+    r->unit_size = NULL;
+    return false;
 }
 
-// Count occurrences of a byte using SWAR masks (8 bytes per iteration).
-// Used by chunk splitter for fast quote parity checks.
-static inline size_t count_char_swar(const uint8_t *data, size_t len, uint8_t target) {
-    size_t count = 0;
-    size_t i = 0;
+int cisv_parser_parse_compressed(cisv_parser *p, const char *path, int threads) {
+    if (!p || !path) return -EINVAL;
 
-    while (i + 8 <= len) {
-        uint64_t word;
-        memcpy(&word, data + i, sizeof(word));
-        count += (size_t)__builtin_popcountll(swar_has_byte(word, target));
-        i += 8;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -errno;
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        int err = -errno;
+        close(fd);
+        return err;
+    }
+
+    DecompRing r;
+    memset(&r, 0, sizeof(r));
+    r.input.fd = -1;
+    uint8_t *map = NULL;
+    size_t map_len = 0;
+    int ret = 0;
+
+    if (S_ISREG(st.st_mode)) {
+        uint8_t magic[4];
+        ssize_t n = pread(fd, magic, sizeof(magic), 0);
+        r.format = cisv_detect_compression(magic, n > 0 ? (size_t)n : 0);
+        if (r.format == CISV_COMPRESSION_NONE || st.st_size == 0) {
+            close(fd);
+            return cisv_parser_parse_file(p, path);
+        }
+        map_len = (size_t)st.st_size;
+        map = (uint8_t *)mmap(NULL, map_len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            ret = -errno;
+            close(fd);
+            return ret;
+        }
+        madvise(map, map_len, MADV_SEQUENTIAL);
+        madvise(map, map_len, MADV_WILLNEED);
+        r.src = map;
+        r.input.data = map;
+        r.input.len = map_len;
+        r.input.eof = true;
+    } else {
+        // Pipes: peek at the first chunk for the magic bytes, then keep it
+        r.input.fd = fd;
+        r.input.buf = malloc(DECOMP_CHUNK);
+        if (!r.input.buf) {
+            close(fd);
+            return -ENOMEM;
+        }
+        ret = decomp_input_refill(&r.input);
+        if (ret < 0) goto out;
+        r.format = cisv_detect_compression(r.input.data, r.input.len);
     }
 
-    for (; i < len; i++) {
-        if (data[i] == target) count++;
+    int workers = threads;
+    if (workers <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = cpus > 1 ? (int)cpus - 1 : 1;
     }
+    if (workers > DECOMP_MAX_THREADS) workers = DECOMP_MAX_THREADS;
 
-    return count;
-}
+    bool parallel = map && workers > 1 && decomp_split_units(&r, map, map_len);
+    if (!parallel) workers = 1;
+    r.total = parallel ? r.unit_count : SIZE_MAX;
+    r.nslots = parallel ? (size_t)workers * 2 + 2 : 4;
+    r.slots = calloc(r.nslots, sizeof(DecompSlot));
+    if (!r.slots) {
+        ret = -ENOMEM;
+        goto out;
+    }
 
-static cisv_chunk_t *split_chunks_with_quote(
-    const cisv_mmap_file_t *file,
-    int num_chunks,
-    int *chunk_count,
-    char quote_char
-) {
-    if (!file || !file->data || num_chunks <= 0 || !chunk_count) {
-        return NULL;
+    // Report codecs that are not compiled in before starting any thread
+    Decoder probe;
+    ret = decoder_init(&probe, r.format);
+    decoder_free(&probe);
+    if (ret < 0) goto out;
+
+    pthread_mutex_init(&r.lock, NULL);
+    pthread_cond_init(&r.filled, NULL);
+    pthread_cond_init(&r.drained, NULL);
+
+    pthread_t tids[DECOMP_MAX_THREADS];
+    int started = 0;
+    for (int i = 0; i < workers; i++) {
+        if (pthread_create(&tids[i], NULL, parallel ? decomp_unit_worker : decomp_stream_worker, &r) != 0) break;
+        started++;
     }
 
-    // Clamp to reasonable chunk count
-    if (num_chunks > 256) num_chunks = 256;
+    parser_reset_input(p);
+    p->streaming_mode = true;
 
-    // Calculate approximate chunk size
-    size_t chunk_size = file->size / num_chunks;
-    if (chunk_size < 4096) {
-        // File too small for requested chunks
-        num_chunks = 1;
-        chunk_size = file->size;
+    if (started == 0) {
+        ret = -EAGAIN;
+    } else {
+        for (;;) {
+            pthread_mutex_lock(&r.lock);
+            DecompSlot *s = &r.slots[r.next_read % r.nslots];
+            while (!r.error && r.next_read < r.total && !(s->ready && s->seq == r.next_read)) {
+                pthread_cond_wait(&r.filled, &r.lock);
+            }
+            bool stop = r.error || r.next_read >= r.total;
+            pthread_mutex_unlock(&r.lock);
+            if (stop) break;
+
+            int err = parser_write_buffered(p, s->buf, s->len);
+            if (err < 0) {
+                ring_fail(&r, err);
+                break;
+            }
+
+            pthread_mutex_lock(&r.lock);
+            s->ready = false;
+            r.next_read++;
+            pthread_cond_broadcast(&r.drained);
+            pthread_mutex_unlock(&r.lock);
+        }
+        ret = r.error;
     }
 
-    cisv_chunk_t *chunks = calloc(num_chunks, sizeof(cisv_chunk_t));
-    if (!chunks) return NULL;
+    for (int i = 0; i < started; i++) pthread_join(tids[i], NULL);
+    if (ret == 0) {
+        cisv_parser_end(p);
+    } else {
+        p->streaming_mode = false;
+    }
 
-    const uint8_t *data = file->data;
-    const uint8_t *end = file->data + file->size;
-    const uint8_t *chunk_start = data;
-    int actual_chunks = 0;
+    pthread_mutex_destroy(&r.lock);
+    pthread_cond_destroy(&r.filled);
+    pthread_cond_destroy(&r.drained);
+
+out:
+    if (r.slots) {
+        for (size_t i = 0; i < r.nslots; i++) free(r.slots[i].buf);
+        free(r.slots);
+    }
+    free(r.unit_start);
+    free(r.unit_size);
+    free(r.input.buf);
+    if (map) munmap(map, map_len);
+    close(fd);
+    return ret;
+}
+
+// Quote-aware row counting helper
+// Counts actual CSV rows by tracking whether newlines are inside quoted fields
+static size_t count_rows_internal(const uint8_t *data, size_t size, char quote_char) {
+    size_t count = 0;
+    bool in_quote = false;
+    size_t i = 0;
+
+    // Unrolled no-quote fast path (16 bytes/lane) for common datasets.
+    while (!in_quote && i + 16 <= size) {
+        uint64_t word0;
+        uint64_t word1;
+        memcpy(&word0, data + i, sizeof(word0));
+        memcpy(&word1, data + i + 8, sizeof(word1));
+
+        uint64_t quote_mask0 = swar_has_byte(word0, (uint8_t)quote_char);
+        uint64_t quote_mask1 = swar_has_byte(word1, (uint8_t)quote_char);
+        if (quote_mask0 | quote_mask1) {
+            break;
+        }
+
+        uint64_t nl_mask0 = swar_has_byte(word0, '\n');
+        uint64_t nl_mask1 = swar_has_byte(word1, '\n');
+        count += (size_t)__builtin_popcountll(nl_mask0);
+        count += (size_t)__builtin_popcountll(nl_mask1);
+        i += 16;
+    }
 
-    for (int i = 0; i < num_chunks && chunk_start < end; i++) {
-        const uint8_t *target_end;
+    // SWAR-accelerated quote-aware counting for remaining bytes.
+    while (i + 8 <= size) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
 
-        if (i == num_chunks - 1) {
-            // Last chunk gets everything remaining
-            target_end = end;
+        if (in_quote) {
+            // While in quoted mode, only quote bytes can change state.
+            uint64_t quote_mask = swar_has_byte(word, (uint8_t)quote_char);
+            if (!quote_mask) {
+                i += 8;
+                continue;
+            }
         } else {
-            // Find newline near target boundary, respecting quoted fields
-            target_end = chunk_start + chunk_size;
-            if (target_end > end) target_end = end;
-
-            // Count quote characters from chunk_start to target_end
-            // to determine if we're inside a quoted field
-            size_t quote_count = count_char_swar(
-                chunk_start,
-                (size_t)(target_end - chunk_start),
-                (uint8_t)quote_char
-            );
-
-            if (quote_count & 1) {
-                // Odd number of quotes: we're inside a quoted field.
-                // Scan forward past the closing quote, then find next newline
-                const uint8_t *scan = target_end;
-                bool in_q = true;
-                while (scan < end && in_q) {
-                    if (*scan == (uint8_t)quote_char) {
-                        if (scan + 1 < end && *(scan + 1) == (uint8_t)quote_char) {
-                            scan += 2;  // Skip escaped quote
-                            continue;
-                        }
-                        in_q = false;
-                    }
-                    scan++;
-                }
-                // Now find the next newline after the closing quote
-                while (scan < end && *scan != '\n') {
-                    scan++;
-                }
-                if (scan < end) {
-                    scan++;  // Include the newline
-                }
-                target_end = scan;
-            } else {
-                // Even quotes: safe to split, scan forward to next newline
-                while (target_end < end && *target_end != '\n') {
-                    target_end++;
-                }
-                if (target_end < end) {
-                    target_end++;  // Include the newline
-                }
+            uint64_t quote_mask = swar_has_byte(word, (uint8_t)quote_char);
+            uint64_t nl_mask = swar_has_byte(word, '\n');
+
+            // Fast path: no quotes in this lane, count all newlines via popcount.
+            if (!quote_mask) {
+                count += (size_t)__builtin_popcountll(nl_mask);
+                i += 8;
+                continue;
             }
         }
 
-        // Count rows in this chunk using quote-aware scalar loop.
-        // chunk_start is always at a row boundary, so initial state is outside quotes.
-        size_t row_count = 0;
-        bool in_quote = false;
-        for (const uint8_t *p = chunk_start; p < target_end; p++) {
-            uint8_t c = *p;
+        // Slow path for mixed/special lanes.
+        for (size_t j = 0; j < 8; j++) {
+            uint8_t c = data[i + j];
             if (in_quote) {
                 if (c == (uint8_t)quote_char) {
-                    if (p + 1 < target_end && *(p + 1) == (uint8_t)quote_char) {
-                        p++;  // Skip escaped quote
+                    // Look ahead for escaped quote ("")
+                    if (i + j + 1 < size && data[i + j + 1] == (uint8_t)quote_char) {
+                        j++;
                     } else {
                         in_quote = false;
                     }
                 }
             } else {
                 if (c == '\n') {
-                    row_count++;
+                    count++;
                 } else if (c == (uint8_t)quote_char) {
                     in_quote = true;
                 }
             }
         }
+        i += 8;
+    }
 
-        chunks[actual_chunks].start = chunk_start;
-        chunks[actual_chunks].end = target_end;
-        chunks[actual_chunks].row_count = row_count;
-        chunks[actual_chunks].chunk_index = actual_chunks;
+    // Scalar tail
+    for (; i < size; i++) {
+        uint8_t c = data[i];
+        if (in_quote) {
+            if (c == (uint8_t)quote_char) {
+                // Look ahead for escaped quote ("")
+                if (i + 1 < size && data[i + 1] == (uint8_t)quote_char) {
+                    i++;  // Skip escaped quote
+                } else {
+                    in_quote = false;
+                }
+            }
+        } else {
+            if (c == '\n') {
+                count++;
+            } else if (c == (uint8_t)quote_char) {
+                in_quote = true;
+            }
+        }
+    }
 
-        chunk_start = target_end;
-        actual_chunks++;
+    // If file doesn't end with newline, count the last row
+    if (size > 0 && data[size - 1] != '\n') {
+        count++;
     }
 
-    *chunk_count = actual_chunks;
-    return chunks;
+    return count;
 }
 
-cisv_chunk_t *cisv_split_chunks(
-    const cisv_mmap_file_t *file,
-    int num_chunks,
-    int *chunk_count
-) {
-    return split_chunks_with_quote(file, num_chunks, chunk_count, '"');
-}
+// Quote-aware row counting
+size_t cisv_parser_count_rows(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
 
-int cisv_parse_chunk(cisv_parser *p, const cisv_chunk_t *chunk) {
-    if (!p || !chunk || !chunk->start) return -1;
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return 0;
+    }
 
-    // Reset parser state for new chunk
-    p->cur = chunk->start;
-    p->end = chunk->end;
+    if (st.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+
+    uint8_t *base = (uint8_t*)mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return 0;
+    }
+
+    madvise(base, st.st_size, MADV_SEQUENTIAL);
+    madvise(base, st.st_size, MADV_WILLNEED);
+
+    size_t count = count_rows_internal(base, st.st_size, '"');
+
+    munmap(base, st.st_size);
+    close(fd);
+    return count;
+}
+
+size_t cisv_parser_count_rows_with_config(const char *path, const cisv_config *config) {
+    if (!config) return cisv_parser_count_rows(path);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return 0;
+    }
+
+    if (st.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+
+    uint8_t *base = (uint8_t*)mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return 0;
+    }
+
+    madvise(base, st.st_size, MADV_SEQUENTIAL);
+    madvise(base, st.st_size, MADV_WILLNEED);
+
+    size_t count = count_rows_internal(base, st.st_size, config->quote);
+
+    munmap(base, st.st_size);
+    close(fd);
+    return count;
+}
+
+static void parser_write_chunk(cisv_parser *p, const uint8_t *chunk, size_t len);
+
+// Append bytes to the held-back run
+static int hold_bytes(cisv_parser *p, const uint8_t *data, size_t len) {
+    if (p->held_len + len > p->held_cap) {
+        size_t cap = p->held_cap ? p->held_cap * 2 : 64;
+        while (cap < p->held_len + len) cap *= 2;
+        uint8_t *held = realloc(p->held, cap);
+        if (!held) return -ENOMEM;
+        p->held = held;
+        p->held_cap = cap;
+    }
+    memcpy(p->held + p->held_len, data, len);
+    p->held_len += len;
+    return 0;
+}
+
+static inline bool is_held_byte(const cisv_parser *p, uint8_t c) {
+    return c == (uint8_t)p->quote || c == '\r';
+}
+
+// Parse a chunk that stays valid until release(user, chunk, len) is called
+static int parser_write_pinned(cisv_parser *p, const uint8_t *chunk, size_t len,
+                               cisv_release_cb release, void *user) {
+    if (!pin_push(p, chunk, len, release, user)) return -ENOMEM;
+    p->pinned_mode = true;
+    parse_pinned_chunk(p, chunk, len);
+    return 0;
+}
+
+// Parse a chunk the caller may reuse on return; partial fields are copied
+static int parser_write_buffered(cisv_parser *p, const uint8_t *chunk, size_t len) {
+    // Enable streaming mode - fields may span chunks
+    p->streaming_mode = true;
+
+    // A chunk that ends in a quote or \r is ambiguous: inside a quoted field
+    // a quote may be the first half of an escaped "" pair or the closing
+    // quote, and a \r may be the first half of a \r\n row end. The trailing
+    // run of such bytes is held back and parsed together with the byte that
+    // follows it, so no chunk handed to the kernel ends on one of them.
+    if (p->held_len > 0 && len > 0) {
+        size_t run = 0;
+        while (run < len && is_held_byte(p, chunk[run])) run++;
+        if (run == len) return hold_bytes(p, chunk, len);
+
+        if (hold_bytes(p, chunk, run + 1) < 0) return -ENOMEM;
+        parser_write_chunk(p, p->held, p->held_len);
+        p->held_len = 0;
+
+        chunk += run + 1;
+        len -= run + 1;
+    }
+
+    size_t held = 0;
+    while (held < len && is_held_byte(p, chunk[len - 1 - held])) held++;
+    if (held > 0 && hold_bytes(p, chunk + len - held, held) < 0) return -ENOMEM;
+    len -= held;
+
+    if (len > 0) parser_write_chunk(p, chunk, len);
+    return 0;
+}
+
+int cisv_parser_write(cisv_parser *p, const uint8_t *chunk, size_t len) {
+    if (!p || (!chunk && len > 0)) return -EINVAL;
+    if (p->release_cb) return parser_write_pinned(p, chunk, len, p->release_cb, p->user);
+    return parser_write_buffered(p, chunk, len);
+}
+
+// Parse one chunk in streaming mode; partial fields are carried over
+static void parser_write_chunk(cisv_parser *p, const uint8_t *chunk, size_t len) {
+    // The previous chunk ended right after a closing quote: consume the
+    // separator that follows it instead of reading it as an empty field.
+    if (p->closed_quote_at_end && len > 0) {
+        p->closed_quote_at_end = false;
+        if (chunk[0] == (uint8_t)p->delimiter) {
+            chunk++;
+            len--;
+        } else if (chunk[0] == '\n') {
+            chunk++;
+            len--;
+            yield_row(p);
+        } else if (chunk[0] == '\r' && len > 1 && chunk[1] == '\n') {
+            chunk += 2;
+            len -= 2;
+            yield_row(p);
+        }
+    }
+
+    p->cur = chunk;
+    p->end = chunk + len;
     p->field_start = p->cur;
-    p->state = S_NORMAL;
-    p->quote_buffer_pos = 0;
-    p->current_row_fields = 0;
-    p->current_row_size = 0;
-    p->skip_current_row = false;
-    p->row_is_comment = false;
 
-    parse_dispatch(p);
+    parse_dispatch(p);
+
+    p->closed_quote_at_end = len > 0 && p->state == S_NORMAL && p->field_start == p->end &&
+                             chunk[len - 1] == (uint8_t)p->quote;
+
+    // After parsing, buffer any partial unquoted field for next chunk
+    // (quoted fields are already handled by quote_buffer)
+    if (p->state == S_NORMAL && p->field_start && p->field_start < p->cur) {
+        // We have a partial field - buffer it for the next write() call
+        size_t partial_len = p->cur - p->field_start;
+        if (partial_len > 0) {
+            append_to_stream_buffer(p, p->field_start, partial_len);
+        }
+    }
+}
+
+void cisv_parser_end(cisv_parser *p) {
+    if (!p) return;
+
+    if (p->pinned_mode) {
+        parse_pinned_end(p);
+        p->pinned_mode = false;
+        return;
+    }
+
+    if (p->streaming_mode) {
+        // Nothing follows the held-back run: parse it as the input's end
+        if (p->held_len > 0) {
+            parser_write_chunk(p, p->held, p->held_len);
+            p->held_len = 0;
+        }
+        if (p->state == S_NORMAL && p->stream_buffer_pos > 0) {
+            yield_stream_buffer_field(p);
+        } else if (p->state == S_QUOTED && p->quote_buffer_pos > 0) {
+            if (p->ecb) {
+                p->ecb(p->user, p->line_num, "Unterminated quoted field at EOF");
+            }
+            yield_quoted_field(p);
+        }
+        if (p->current_col > 0) {
+            yield_row(p);
+        }
+        p->streaming_mode = false;
+        p->closed_quote_at_end = false;
+        return;
+    }
+
+    if (p->state == S_NORMAL && p->field_start && p->field_start < p->cur) {
+        yield_field(p, p->field_start, p->cur);
+    } else if (p->state == S_QUOTED && p->quote_buffer_pos > 0) {
+        yield_quoted_field(p);
+    }
+    if (p->current_col > 0) {
+        yield_row(p);
+    }
+}
+
+int cisv_parser_get_line_number(const cisv_parser *p) {
+    return p ? p->line_num : 0;
+}
+
+// =============================================================================
+// Parallel Chunk Processing Implementation (1 Billion Row Challenge technique)
+// =============================================================================
+
+cisv_mmap_file_t *cisv_mmap_open(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return NULL;
+    }
+
+    if (st.st_size == 0) {
+        close(fd);
+        errno = EINVAL;
+        return NULL;
+    }
+
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+
+    uint8_t *data = (uint8_t*)mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
+    if (data == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+
+    // Advise kernel for sequential access
+    madvise(data, st.st_size, MADV_SEQUENTIAL);
+    madvise(data, st.st_size, MADV_WILLNEED);
+
+    cisv_mmap_file_t *file = malloc(sizeof(cisv_mmap_file_t));
+    if (!file) {
+        munmap(data, st.st_size);
+        close(fd);
+        return NULL;
+    }
+
+    file->data = data;
+    file->size = st.st_size;
+    file->fd = fd;
+
+    return file;
+}
+
+void cisv_mmap_close(cisv_mmap_file_t *file) {
+    if (!file) return;
+    if (file->data) munmap(file->data, file->size);
+    if (file->fd >= 0) close(file->fd);
+    free(file);
+}
+
+// Per-range quote/newline summary used to place chunk boundaries. A range is
+// scanned once without knowing whether it starts inside a quoted field; the
+// results for both starting states fall out of the same in-quote mask.
+typedef struct {
+    size_t quotes;               // Quote characters in the range (parity)
+    size_t first_row[2];         // Offset just past the first row-ending newline
+                                 // when starting outside [0] / inside [1] quotes
+    size_t rows[2];              // Row-ending newlines for each starting state
+} chunk_scan_t;
+
+static void chunk_scan(const uint8_t *data, size_t len, uint8_t quote, chunk_scan_t *out) {
+    uint64_t quote_carry = 0;    // All-ones while inside quotes (starting outside)
+    size_t quotes = 0;
+    size_t rows_out = 0, rows_in = 0;
+    size_t first_out = SIZE_MAX, first_in = SIZE_MAX;
+    uint8_t tail[64];
+
+    for (size_t off = 0; off < len; off += 64) {
+        const uint8_t *block = data + off;
+        uint64_t valid = ~0ULL;
+        if (len - off < 64) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, len - off);
+            block = tail;
+            valid = (1ULL << (len - off)) - 1;
+        }
+
+        uint64_t quote_bits, delim_bits, nl_bits;
+        bitmask_classify_block(block, '\n', quote, &quote_bits, &delim_bits, &nl_bits);
+        quote_bits &= valid;
+        nl_bits &= valid;
+
+        uint64_t in_quote = bitmask_prefix_xor(quote_bits) ^ quote_carry;
+        quote_carry = (uint64_t)((int64_t)in_quote >> 63);
+
+        // Starting inside quotes simply inverts the in-quote mask
+        uint64_t rows_if_out = nl_bits & ~in_quote;
+        uint64_t rows_if_in = nl_bits & in_quote;
+
+        if (first_out == SIZE_MAX && rows_if_out) {
+            first_out = off + (size_t)__builtin_ctzll(rows_if_out) + 1;
+        }
+        if (first_in == SIZE_MAX && rows_if_in) {
+            first_in = off + (size_t)__builtin_ctzll(rows_if_in) + 1;
+        }
+        rows_out += (size_t)__builtin_popcountll(rows_if_out);
+        rows_in += (size_t)__builtin_popcountll(rows_if_in);
+        quotes += (size_t)__builtin_popcountll(quote_bits);
+    }
+
+    out->quotes = quotes;
+    out->first_row[0] = first_out;
+    out->first_row[1] = first_in;
+    out->rows[0] = rows_out;
+    out->rows[1] = rows_in;
+}
+
+// Prefix-combine range scans: the quote state entering range i is the parity
+// of all earlier quotes, which selects that range's boundary and row count.
+// Each chunk starts just past the first row-ending newline of its range.
+// initial_state 1 derives the alternate split (every range start flipped).
+// Returns the number of chunks written (at most range_count).
+static int chunks_from_scans(const cisv_mmap_file_t *file, size_t range_size,
+                             int range_count, const chunk_scan_t *scans,
+                             int initial_state, cisv_chunk_t *chunks) {
+    const uint8_t *data = file->data;
+    int state = initial_state;
+    int count = 0;
+    size_t rows_before = 0;      // Row-ending newlines before the current range
+    size_t rows_at_start = 0;    // ... before the current chunk
+
+    chunks[0].start = data;
+    for (int i = 0; i < range_count; i++) {
+        size_t first = scans[i].first_row[state];
+        if (i > 0 && first != SIZE_MAX) {
+            size_t boundary = (size_t)i * range_size + first;
+            if (boundary < file->size) {
+                chunks[count].end = data + boundary;
+                chunks[count].row_count = rows_before + 1 - rows_at_start;
+                chunks[count].chunk_index = count;
+                rows_at_start = rows_before + 1;
+                count++;
+                chunks[count].start = data + boundary;
+            }
+        }
+        rows_before += scans[i].rows[state];
+        state ^= (int)(scans[i].quotes & 1);
+    }
+
+    chunks[count].end = data + file->size;
+    chunks[count].row_count = rows_before - rows_at_start;
+    chunks[count].chunk_index = count;
+    return count + 1;
+}
+
+static cisv_chunk_t *split_chunks_with_quote(
+    const cisv_mmap_file_t *file,
+    int num_chunks,
+    int *chunk_count,
+    char quote_char
+) {
+    if (!file || !file->data || num_chunks <= 0 || !chunk_count) {
+        return NULL;
+    }
+
+    // Clamp to reasonable chunk count
+    if (num_chunks > 256) num_chunks = 256;
+
+    // Calculate approximate chunk size
+    size_t chunk_size = file->size / num_chunks;
+    if (chunk_size < 4096) {
+        // File too small for requested chunks
+        num_chunks = 1;
+        chunk_size = file->size;
+    }
+
+    cisv_chunk_t *chunks = calloc(num_chunks, sizeof(cisv_chunk_t));
+    chunk_scan_t *scans = malloc(num_chunks * sizeof(chunk_scan_t));
+    if (!chunks || !scans) {
+        free(chunks);
+        free(scans);
+        return NULL;
+    }
+
+    // Single SIMD pass per range (cisv_pool_parse_file runs these on workers)
+    for (int i = 0; i < num_chunks; i++) {
+        size_t start = (size_t)i * chunk_size;
+        size_t len = (i == num_chunks - 1) ? file->size - start : chunk_size;
+        chunk_scan(file->data + start, len, (uint8_t)quote_char, &scans[i]);
+    }
+
+    *chunk_count = chunks_from_scans(file, chunk_size, num_chunks, scans, 0, chunks);
+    free(scans);
+    return chunks;
+}
+
+cisv_chunk_t *cisv_split_chunks(
+    const cisv_mmap_file_t *file,
+    int num_chunks,
+    int *chunk_count
+) {
+    return split_chunks_with_quote(file, num_chunks, chunk_count, '"');
+}
+
+int cisv_parse_chunk(cisv_parser *p, const cisv_chunk_t *chunk) {
+    if (!p || !chunk || !chunk->start) return -1;
+
+    // Reset parser state for new chunk
+    p->cur = chunk->start;
+    p->end = chunk->end;
+    p->field_start = p->cur;
+    p->state = S_NORMAL;
+    p->quote_buffer_pos = 0;
+    p->current_row_fields = 0;
+    p->current_row_size = 0;
+    p->current_col = 0;
+    p->skip_current_row = false;
+    p->row_is_comment = false;
+
+    parse_dispatch(p);
+
+    return 0;
+}
+
+// =============================================================================
+// Batch Parsing Implementation
+// High-performance API that returns all data at once (no callbacks)
+// =============================================================================
+
+// Initial allocation sizes for batch parsing
+#define BATCH_INITIAL_ROWS 1024
+#define BATCH_INITIAL_FIELDS 8192
+#define BATCH_INITIAL_DATA (1024 * 1024)  // 1MB initial data buffer
+
+// Internal collector for batch parsing
+typedef struct {
+    cisv_result_t *result;
+    size_t current_row_start;  // Index in all_fields where current row starts
+} BatchCollector;
+
+// Ensure result has capacity for more rows
+static inline bool batch_ensure_rows(cisv_result_t *r, size_t needed) {
+    if (r->row_count + needed <= r->row_capacity) return true;
+
+    // 1.5x growth: reduces memory waste from ~50% to ~33%
+    size_t required = r->row_count + needed;
+    size_t new_cap = r->row_capacity + (r->row_capacity >> 1);
+    if (new_cap < required) new_cap = required;
+
+    cisv_row_t *new_rows = realloc(r->rows, new_cap * sizeof(cisv_row_t));
+    if (!new_rows) return false;
+
+    r->rows = new_rows;
+    r->row_capacity = new_cap;
+    return true;
+}
+
+// Ensure result has capacity for more fields
+static inline bool batch_ensure_fields(cisv_result_t *r, size_t needed) {
+    if (r->total_fields + needed <= r->fields_capacity) return true;
+
+    // 1.5x growth: reduces memory waste from ~50% to ~33%
+    size_t required = r->total_fields + needed;
+    size_t new_cap = r->fields_capacity + (r->fields_capacity >> 1);
+    if (new_cap < required) new_cap = required;
+
+    char **new_fields = realloc(r->all_fields, new_cap * sizeof(char*));
+    if (!new_fields) return false;
+
+    size_t *new_lengths = realloc(r->all_lengths, new_cap * sizeof(size_t));
+    if (!new_lengths) {
+        // Preserve the successful realloc result so ownership is not lost
+        // if the second growth step fails.
+        r->all_fields = new_fields;
+        return false;
+    }
+
+    r->all_fields = new_fields;
+    r->all_lengths = new_lengths;
+    r->fields_capacity = new_cap;
+    return true;
+}
+
+// Ensure result has capacity for more field data
+// NOTE: all_fields[] stores offsets (not pointers) during parsing to avoid
+// O(n) pointer fixup on reallocation. Offsets are converted to pointers
+// in batch_result_finalize() after parsing completes.
+static inline bool batch_ensure_data(cisv_result_t *r, size_t needed) {
+    if (r->field_data_size + needed <= r->field_data_capacity) return true;
+
+    // 1.5x growth: reduces memory waste from ~50% to ~33%
+    size_t required = r->field_data_size + needed;
+    size_t new_cap = r->field_data_capacity + (r->field_data_capacity >> 1);
+    if (new_cap < required) new_cap = required;
+
+    // Round up to 64-byte alignment for cache efficiency
+    new_cap = (new_cap + 63) & ~(size_t)63;
+
+    char *new_data = realloc(r->field_data, new_cap);
+    if (!new_data) return false;
+
+    // No pointer fixup needed - we store offsets, not pointers
+    r->field_data = new_data;
+    r->field_data_capacity = new_cap;
+    return true;
+}
+
+// Batch field callback - accumulates fields into result
+// NOTE: stores field offset (not pointer) to avoid O(n) fixup on realloc
+static void batch_field_cb(void *user, const char *data, size_t len) {
+    BatchCollector *bc = (BatchCollector *)user;
+    cisv_result_t *r = bc->result;
+
+    // Ensure we have space
+    if (!batch_ensure_fields(r, 1)) {
+        r->error_code = -1;
+        snprintf(r->error_message, sizeof(r->error_message), "Out of memory (fields)");
+        return;
+    }
+
+    if (!batch_ensure_data(r, len + 1)) {
+        r->error_code = -1;
+        snprintf(r->error_message, sizeof(r->error_message), "Out of memory (data)");
+        return;
+    }
+
+    // Store current offset before copying (field_data may reallocate)
+    size_t offset = r->field_data_size;
+
+    // Copy field data (null-terminated for convenience)
+    char *dest = r->field_data + offset;
+    memcpy(dest, data, len);
+    dest[len] = '\0';
+
+    // Record field offset (converted to pointer in batch_result_finalize)
+    r->all_fields[r->total_fields] = (char*)(uintptr_t)offset;
+    r->all_lengths[r->total_fields] = len;
+    r->total_fields++;
+    r->field_data_size += len + 1;
+}
+
+// Batch row callback - stores field start index (pointers set up at end)
+// We store the start index in the fields pointer and convert to actual
+// pointers after parsing is complete (to handle reallocation during parsing)
+static void batch_row_cb(void *user) {
+    BatchCollector *bc = (BatchCollector *)user;
+    cisv_result_t *r = bc->result;
+
+    if (!batch_ensure_rows(r, 1)) {
+        r->error_code = -1;
+        snprintf(r->error_message, sizeof(r->error_message), "Out of memory (rows)");
+        return;
+    }
+
+    // Store field count and start index (not actual pointers - those are set later)
+    size_t field_count = r->total_fields - bc->current_row_start;
+    cisv_row_t *row = &r->rows[r->row_count];
+
+    // Store start index as intptr_t (will be converted to pointer later)
+    row->fields = (char **)(intptr_t)bc->current_row_start;
+    row->field_lengths = NULL;  // Will be set during finalization
+    row->field_count = field_count;
+
+    r->row_count++;
+    bc->current_row_start = r->total_fields;
+}
+
+// Finalize result by converting stored indices/offsets to actual pointers
+// Must be called after all parsing is complete
+static void batch_result_finalize(cisv_result_t *r) {
+    // First, convert all field offsets to actual pointers
+    // This is O(n) but only done once at the end, not on every realloc
+    for (size_t i = 0; i < r->total_fields; i++) {
+        size_t offset = (size_t)(uintptr_t)r->all_fields[i];
+        r->all_fields[i] = r->field_data + offset;
+    }
+
+    // Now convert row field indices to actual pointers
+    for (size_t i = 0; i < r->row_count; i++) {
+        size_t start_index = (size_t)(intptr_t)r->rows[i].fields;
+        r->rows[i].fields = &r->all_fields[start_index];
+        r->rows[i].field_lengths = &r->all_lengths[start_index];
+    }
+}
+
+// Batch error callback
+static void batch_error_cb(void *user, int line, const char *msg) {
+    BatchCollector *bc = (BatchCollector *)user;
+    cisv_result_t *r = bc->result;
+
+    if (r->error_code == 0) {
+        r->error_code = -1;
+        snprintf(r->error_message, sizeof(r->error_message),
+                 "Parse error at line %d: %s", line, msg ? msg : "unknown error");
+    }
+}
+
+// Maximum initial allocation for pre-sized buffers (500MB)
+#define BATCH_MAX_INITIAL_ALLOC (500 * 1024 * 1024)
+
+// Allocate and initialize a new result structure with size hints
+// file_size_hint: estimated file size (0 to use defaults)
+static cisv_result_t *batch_result_create_with_hint(size_t file_size_hint) {
+    cisv_result_t *r = calloc(1, sizeof(cisv_result_t));
+    if (!r) return NULL;
+
+    // Estimate buffer sizes based on file size
+    // Heuristics: ~100 bytes/row average, ~8 fields/row average
+    size_t row_cap = BATCH_INITIAL_ROWS;
+    size_t field_cap = BATCH_INITIAL_FIELDS;
+    size_t data_cap = BATCH_INITIAL_DATA;
+
+    if (file_size_hint > 0) {
+        // Estimate rows: assume ~100 bytes per row on average
+        size_t est_rows = file_size_hint / 100;
+        if (est_rows > row_cap && est_rows * sizeof(cisv_row_t) < BATCH_MAX_INITIAL_ALLOC) {
+            row_cap = est_rows;
+        }
+
+        // Estimate fields: assume ~8 fields per row
+        size_t est_fields = est_rows * 8;
+        if (est_fields > field_cap && est_fields * sizeof(char*) < BATCH_MAX_INITIAL_ALLOC) {
+            field_cap = est_fields;
+        }
+
+        // Field data needs at least file_size bytes (strings + null terminators)
+        // Add 10% overhead for null terminators
+        size_t est_data = file_size_hint + (file_size_hint / 10);
+        if (est_data > data_cap && est_data < BATCH_MAX_INITIAL_ALLOC) {
+            data_cap = est_data;
+        }
+
+        // Align data capacity to 64 bytes for cache efficiency
+        data_cap = (data_cap + 63) & ~(size_t)63;
+    }
+
+    // Allocate buffers with estimated sizes
+    r->rows = malloc(row_cap * sizeof(cisv_row_t));
+    r->all_fields = malloc(field_cap * sizeof(char*));
+    r->all_lengths = malloc(field_cap * sizeof(size_t));
+    r->field_data = malloc(data_cap);
+
+    if (!r->rows || !r->all_fields || !r->all_lengths || !r->field_data) {
+        free(r->rows);
+        free(r->all_fields);
+        free(r->all_lengths);
+        free(r->field_data);
+        free(r);
+        return NULL;
+    }
+
+    r->row_capacity = row_cap;
+    r->fields_capacity = field_cap;
+    r->field_data_capacity = data_cap;
+
+    return r;
+}
+
+// Allocate and initialize a new result structure with default sizes
+static cisv_result_t *batch_result_create(void) {
+    return batch_result_create_with_hint(0);
+}
+
+void cisv_result_free(cisv_result_t *result) {
+    if (!result) return;
+
+    // Note: row->fields and row->field_lengths point into all_fields/all_lengths
+    // so we don't need to free them separately
+    free(result->rows);
+    free(result->all_fields);
+    free(result->all_lengths);
+    free(result->field_data);
+    free(result);
+}
+
+cisv_result_t *cisv_parse_file_batch(const char *path, const cisv_config *config) {
+    if (!path) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    // Get file size for buffer pre-sizing (reduces reallocations)
+    size_t file_size_hint = 0;
+    struct stat st;
+    if (stat(path, &st) == 0 && S_ISREG(st.st_mode)) {
+        file_size_hint = (size_t)st.st_size;
+    }
+
+    cisv_result_t *result = batch_result_create_with_hint(file_size_hint);
+    if (!result) {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    BatchCollector bc = {
+        .result = result,
+        .current_row_start = 0
+    };
+
+    // Create config with batch callbacks
+    cisv_config batch_config;
+    if (config) {
+        batch_config = *config;
+    } else {
+        cisv_config_init(&batch_config);
+    }
+    batch_config.field_cb = batch_field_cb;
+    batch_config.row_cb = batch_row_cb;
+    batch_config.error_cb = batch_error_cb;
+    batch_config.user = &bc;
+    batch_config.release_cb = NULL;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&batch_config);
+    if (!parser) {
+        cisv_result_free(result);
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    int parse_result = cisv_parser_parse_file(parser, path);
+    cisv_parser_destroy(parser);
+
+    if (parse_result < 0) {
+        result->error_code = parse_result;
+        snprintf(result->error_message, sizeof(result->error_message),
+                 "Failed to parse file: %s", strerror(-parse_result));
+    }
+
+    // Convert stored indices to actual pointers now that parsing is complete
+    batch_result_finalize(result);
+
+    return result;
+}
+
+cisv_result_t *cisv_parse_string_batch(const char *data, size_t len, const cisv_config *config) {
+    if (!data) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    cisv_result_t *result = batch_result_create();
+    if (!result) {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    BatchCollector bc = {
+        .result = result,
+        .current_row_start = 0
+    };
+
+    // Create config with batch callbacks
+    cisv_config batch_config;
+    if (config) {
+        batch_config = *config;
+    } else {
+        cisv_config_init(&batch_config);
+    }
+    batch_config.field_cb = batch_field_cb;
+    batch_config.row_cb = batch_row_cb;
+    batch_config.error_cb = batch_error_cb;
+    batch_config.user = &bc;
+    batch_config.release_cb = NULL;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&batch_config);
+    if (!parser) {
+        cisv_result_free(result);
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    cisv_parser_write(parser, (const uint8_t *)data, len);
+    cisv_parser_end(parser);
+    cisv_parser_destroy(parser);
+
+    // Convert stored indices to actual pointers now that parsing is complete
+    batch_result_finalize(result);
+
+    return result;
+}
+
+// =============================================================================
+// Columnar Batch Parsing Implementation
+// Fields are appended straight into per-column Arrow string arrays: 4 bytes
+// of offset per field instead of a pointer, a length and a NUL terminator.
+// Typed parsing samples the first rows as strings, fixes a type per column
+// and converts the sample; after that values go straight to native arrays.
+// Repetitive string columns become dictionaries: each distinct value is
+// stored once and rows hold uint32 codes found through a per-column hash
+// table that lives only for the parse.
+// =============================================================================
+
+#define COLUMNAR_INITIAL_COLUMNS 16
+#define COLUMNAR_INITIAL_ROWS 1024
+#define COLUMNAR_INITIAL_VALUES 4096
+#define COLUMNAR_INFER_ROWS 1000
+#define COLUMNAR_DICT_MAX_VALUES 4096   // More distinct values than this: plain strings
+#define COLUMNAR_DICT_SLOTS 8192        // Hash slots per dictionary (power of two)
+
+// Internal collector for columnar parsing
+typedef struct {
+    cisv_columnar_t *result;
+    size_t current_col;        // Column the next field of the current row goes to
+    bool typed;                // Typed parsing requested
+    bool types_fixed;          // Sample done (or types given): typed appends from here
+    size_t infer_rows;         // Rows sampled before types are fixed
+    const cisv_type_t *forced; // Types from an earlier pass (NULL = infer)
+    size_t forced_count;
+    bool *mismatch;            // Columns that met a value their type cannot hold
+    size_t mismatch_capacity;
+    uint32_t **dict_slots;     // Per column: code + 1 of the value hashed there (0 = empty)
+    size_t dict_slots_capacity;
+    bool dictionary_encode;    // config->dictionary_encode: repetitive strings become dictionaries
+    bool header;               // Current row is the header
+} ColumnarCollector;
+
+// -----------------------------------------------------------------------------
+// Native value parsers. Each accepts the whole field or nothing, so a column
+// only gets a type whose text form every sampled value actually has.
+// -----------------------------------------------------------------------------
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+// Eight ASCII digits per step (SWAR): validate, then fold pairwise with
+// three multiplies instead of eight multiply-adds
+static inline bool swar_is_eight_digits(uint64_t v) {
+    return !(((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) &
+             0x8080808080808080ULL);
+}
+
+static inline uint32_t swar_parse_eight_digits(uint64_t v) {
+    const uint64_t mask = 0x000000FF000000FFULL;
+    const uint64_t mul1 = 0x000F424000000064ULL;  // 100 + (1000000 << 32)
+    const uint64_t mul2 = 0x0000271000000001ULL;  // 1 + (10000 << 32)
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t)v;
+}
+#endif
+
+// Accumulate a run of digits into *acc and return how many were consumed.
+// Only the first 19 digits are guaranteed to fit; callers check the count.
+static inline size_t parse_digit_run(const char *s, size_t len, uint64_t *acc) {
+    uint64_t v = *acc;
+    size_t i = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    while (len - i >= 8) {
+        uint64_t chunk;
+        memcpy(&chunk, s + i, 8);
+        if (!swar_is_eight_digits(chunk)) break;
+        v = v * 100000000ULL + swar_parse_eight_digits(chunk);
+        i += 8;
+    }
+#endif
+    while (i < len && (unsigned char)(s[i] - '0') <= 9) {
+        v = v * 10 + (uint64_t)(s[i] - '0');
+        i++;
+    }
+    *acc = v;
+    return i;
+}
+
+// Integers with leading zeros are left to strings: they are usually codes
+// (zip, account numbers) whose zeros matter
+static bool parse_int64_field(const char *s, size_t len, int64_t *out) {
+    size_t i = 0;
+    bool neg = false;
+    if (len > 0 && (s[0] == '-' || s[0] == '+')) {
+        neg = s[0] == '-';
+        i = 1;
+    }
+
+    size_t digits = len - i;
+    if (digits == 0 || digits > 19) return false;
+    if (s[i] == '0' && digits > 1) return false;
+
+    uint64_t v = 0;
+    if (parse_digit_run(s + i, digits, &v) != digits) return false;
+    if (v > (uint64_t)INT64_MAX + (neg ? 1 : 0)) return false;
+
+    *out = neg ? -(int64_t)(v - 1) - 1 : (int64_t)v;
+    return true;
+}
+
+// Doubles hold every integer in [-2^53, 2^53] exactly
+#define FLOAT64_EXACT_INT (1LL << 53)
+
+// True for an integer literal (sign and digits only) beyond 2^53, which a
+// float64 column could only store rounded
+static bool integer_exceeds_float64(const char *s, size_t len) {
+    size_t i = (len > 0 && (s[0] == '-' || s[0] == '+')) ? 1 : 0;
+    size_t digits = len - i;
+    if (digits < 16) return false;
+
+    uint64_t v = 0;
+    if (parse_digit_run(s + i, digits, &v) != digits) return false;
+    return digits > 19 || v > (uint64_t)FLOAT64_EXACT_INT;
+}
+
+static const double float_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Decimal or scientific notation. Mantissas up to 2^53 with a power of ten
+// up to 22 convert exactly with one multiply or divide (Clinger's fast
+// path); anything else goes through strtod for correct rounding.
+static bool parse_float64_field(const char *s, size_t len, double *out) {
+    size_t i = 0;
+    bool neg = false;
+    if (len > 0 && (s[0] == '-' || s[0] == '+')) {
+        neg = s[0] == '-';
+        i = 1;
+    }
+
+    size_t int_start = i;
+    uint64_t mantissa = 0;
+    size_t int_digits = parse_digit_run(s + i, len - i, &mantissa);
+    i += int_digits;
+    if (int_digits > 1 && s[int_start] == '0') return false;
+
+    size_t frac_digits = 0;
+    if (i < len && s[i] == '.') {
+        i++;
+        frac_digits = parse_digit_run(s + i, len - i, &mantissa);
+        i += frac_digits;
+    }
+    if (int_digits + frac_digits == 0) return false;
+
+    int64_t exp10 = 0;
+    if (i < len && (s[i] == 'e' || s[i] == 'E')) {
+        i++;
+        bool exp_neg = false;
+        if (i < len && (s[i] == '-' || s[i] == '+')) {
+            exp_neg = s[i] == '-';
+            i++;
+        }
+        uint64_t e = 0;
+        size_t exp_digits = parse_digit_run(s + i, len - i, &e);
+        if (exp_digits == 0 || exp_digits > 4) return false;
+        i += exp_digits;
+        exp10 = exp_neg ? -(int64_t)e : (int64_t)e;
+    }
+    if (i != len) return false;
+
+    exp10 -= (int64_t)frac_digits;
+    if (int_digits + frac_digits <= 19 && mantissa <= (1ULL << 53) &&
+        exp10 >= -22 && exp10 <= 22) {
+        double v = (double)mantissa;
+        v = exp10 < 0 ? v / float_pow10[-exp10] : v * float_pow10[exp10];
+        *out = neg ? -v : v;
+        return true;
+    }
+
+    char buf[64];
+    char *tmp = len < sizeof(buf) ? buf : malloc(len + 1);
+    if (!tmp) return false;
+    memcpy(tmp, s, len);
+    tmp[len] = '\0';
+    char *end;
+    double v = strtod(tmp, &end);
+    bool ok = end == tmp + len;
+    if (tmp != buf) free(tmp);
+    if (ok) *out = v;
+    return ok;
+}
+
+static bool parse_bool_field(const char *s, size_t len, bool *out) {
+    if (len == 4 && (s[0] | 0x20) == 't' && (s[1] | 0x20) == 'r' &&
+        (s[2] | 0x20) == 'u' && (s[3] | 0x20) == 'e') {
+        *out = true;
+        return true;
+    }
+    if (len == 5 && (s[0] | 0x20) == 'f' && (s[1] | 0x20) == 'a' &&
+        (s[2] | 0x20) == 'l' && (s[3] | 0x20) == 's' && (s[4] | 0x20) == 'e') {
+        *out = false;
+        return true;
+    }
+    return false;
+}
+
+// YYYY-MM-DD to days since 1970-01-01 (proleptic Gregorian)
+static bool parse_date_field(const char *s, size_t len, int32_t *out) {
+    if (len != 10 || s[4] != '-' || s[7] != '-') return false;
+    for (int i = 0; i < 10; i++) {
+        if (i != 4 && i != 7 && (unsigned char)(s[i] - '0') > 9) return false;
+    }
+
+    int y = (s[0] - '0') * 1000 + (s[1] - '0') * 100 + (s[2] - '0') * 10 + (s[3] - '0');
+    int m = (s[5] - '0') * 10 + (s[6] - '0');
+    int d = (s[8] - '0') * 10 + (s[9] - '0');
+    static const int month_days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (m < 1 || m > 12 || d < 1) return false;
+    bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    if (d > month_days[m - 1] + (m == 2 && leap ? 1 : 0)) return false;
+
+    // Days from civil: shift the year to start in March so leap days come last
+    y -= m <= 2;
+    int era = y / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    *out = era * 146097 + doe - 719468;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Column storage
+// -----------------------------------------------------------------------------
+
+static inline size_t column_offset(const cisv_column_t *col, size_t row) {
+    return col->offset_width == 4 ? (size_t)col->offsets[row] : (size_t)col->offsets64[row];
+}
+
+static inline void column_set_offset(cisv_column_t *col, size_t row, size_t offset) {
+    if (col->offset_width == 4) {
+        col->offsets[row] = (int32_t)offset;
+    } else {
+        col->offsets64[row] = (int64_t)offset;
+    }
+}
+
+static size_t column_type_width(cisv_type_t type) {
+    switch (type) {
+        case CISV_TYPE_INT64: return sizeof(int64_t);
+        case CISV_TYPE_FLOAT64: return sizeof(double);
+        case CISV_TYPE_DATE: return sizeof(int32_t);
+        case CISV_TYPE_DICT: return sizeof(uint32_t);
+        default: return 0;
+    }
+}
+
+// Typed storage for new_cap rows (bool values are bit-packed like validity)
+static bool column_grow_data(cisv_column_t *col, size_t new_cap) {
+    size_t old_bytes, new_bytes;
+    if (col->type == CISV_TYPE_BOOL) {
+        old_bytes = (col->capacity + 7) / 8;
+        new_bytes = (new_cap + 7) / 8;
+    } else {
+        old_bytes = col->capacity * column_type_width(col->type);
+        new_bytes = new_cap * column_type_width(col->type);
+    }
+    void *data = realloc(col->data, new_bytes);
+    if (!data) return false;
+    memset((char *)data + old_bytes, 0, new_bytes - old_bytes);
+    col->data = data;
+    return true;
+}
+
+// Ensure room for one more row (length + 2 offsets)
+static bool column_ensure_rows(cisv_column_t *col) {
+    if (col->length + 2 <= col->capacity) return true;
+
+    size_t new_cap = col->capacity ? col->capacity * 2 : COLUMNAR_INITIAL_ROWS;
+    if (col->type != CISV_TYPE_STRING) {
+        if (!column_grow_data(col, new_cap)) return false;
+    } else if (col->offset_width == 4) {
+        int32_t *offsets = realloc(col->offsets, new_cap * sizeof(int32_t));
+        if (!offsets) return false;
+        col->offsets = offsets;
+    } else {
+        int64_t *offsets = realloc(col->offsets64, new_cap * sizeof(int64_t));
+        if (!offsets) return false;
+        col->offsets64 = offsets;
+    }
+    if (col->validity) {
+        size_t old_bytes = (col->capacity + 7) / 8;
+        uint8_t *validity = realloc(col->validity, (new_cap + 7) / 8);
+        if (!validity) return false;
+        memset(validity + old_bytes, 0, (new_cap + 7) / 8 - old_bytes);
+        col->validity = validity;
+    }
+    col->capacity = new_cap;
+    return true;
+}
+
+// Mark a row null. The bitmap is allocated on the first null, with every
+// row before col->length marked present.
+static bool column_clear_valid(cisv_column_t *col, size_t row) {
+    if (!col->validity) {
+        col->validity = calloc((col->capacity + 7) / 8, 1);
+        if (!col->validity) return false;
+        memset(col->validity, 0xFF, col->length / 8);
+        if (col->length & 7) {
+            col->validity[col->length / 8] = (uint8_t)((1u << (col->length & 7)) - 1);
+        }
+    }
+    col->validity[row >> 3] &= (uint8_t)~(1u << (row & 7));
+    col->null_count++;
+    return true;
+}
+
+static inline void column_set_valid(cisv_column_t *col, size_t row) {
+    if (col->validity) {
+        col->validity[row >> 3] |= (uint8_t)(1u << (row & 7));
+    }
+}
+
+// Switch to 64-bit offsets (Arrow large_utf8) once 32-bit ones would overflow
+static bool column_widen_offsets(cisv_column_t *col) {
+    int64_t *offsets = malloc(col->capacity * sizeof(int64_t));
+    if (!offsets) return false;
+    for (size_t i = 0; i <= col->length; i++) {
+        offsets[i] = col->offsets[i];
+    }
+    free(col->offsets);
+    col->offsets = NULL;
+    col->offsets64 = offsets;
+    col->offset_width = 8;
+    return true;
+}
+
+static bool column_reserve_values(cisv_column_t *col, size_t needed) {
+    if (needed <= col->values_capacity) return true;
+
+    size_t new_cap = col->values_capacity ? col->values_capacity * 2 : COLUMNAR_INITIAL_VALUES;
+    if (new_cap < needed) new_cap = needed;
+    char *values = realloc(col->values, new_cap);
+    if (!values) return false;
+    col->values = values;
+    col->values_capacity = new_cap;
+    return true;
+}
+
+static bool column_append(cisv_column_t *col, const char *data, size_t len) {
+    if (!column_ensure_rows(col)) return false;
+
+    size_t needed = col->values_size + len;
+    if (col->offset_width == 4 && needed > INT32_MAX && !column_widen_offsets(col)) {
+        return false;
+    }
+    if (!column_reserve_values(col, needed)) return false;
+
+    memcpy(col->values + col->values_size, data, len);
+    col->values_size = needed;
+    column_set_valid(col, col->length);
+    col->length++;
+    column_set_offset(col, col->length, col->values_size);
+    return true;
+}
+
+static bool column_append_null(cisv_column_t *col) {
+    if (!column_ensure_rows(col)) return false;
+    if (!column_clear_valid(col, col->length)) return false;
+    col->length++;
+    if (col->type == CISV_TYPE_STRING) {
+        column_set_offset(col, col->length, col->values_size);
+    }
+    return true;
+}
+
+// Store a field as the column's native type; false if it does not fit
+static bool column_store_typed(cisv_column_t *col, size_t row, const char *s, size_t len) {
+    switch (col->type) {
+        case CISV_TYPE_INT64: {
+            int64_t v;
+            if (!parse_int64_field(s, len, &v)) return false;
+            ((int64_t *)col->data)[row] = v;
+            return true;
+        }
+        case CISV_TYPE_FLOAT64: {
+            double v;
+            if (!parse_float64_field(s, len, &v)) return false;
+            if (integer_exceeds_float64(s, len)) return false;
+            ((double *)col->data)[row] = v;
+            return true;
+        }
+        case CISV_TYPE_BOOL: {
+            bool v;
+            if (!parse_bool_field(s, len, &v)) return false;
+            uint8_t *bits = (uint8_t *)col->data;
+            if (v) bits[row >> 3] |= (uint8_t)(1u << (row & 7));
+            else bits[row >> 3] &= (uint8_t)~(1u << (row & 7));
+            return true;
+        }
+        case CISV_TYPE_DATE: {
+            int32_t v;
+            if (!parse_date_field(s, len, &v)) return false;
+            ((int32_t *)col->data)[row] = v;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// int64 and double have the same width, so widening is done in place.
+// False (column untouched) when an integer beyond 2^53 would be rounded.
+static bool column_widen_to_float(cisv_column_t *col) {
+    int64_t *ints = (int64_t *)col->data;
+    double *floats = (double *)col->data;
+    for (size_t i = 0; i < col->length; i++) {
+        if (ints[i] > FLOAT64_EXACT_INT || ints[i] < -FLOAT64_EXACT_INT) return false;
+    }
+    for (size_t i = 0; i < col->length; i++) {
+        floats[i] = (double)ints[i];
+    }
+    col->type = CISV_TYPE_FLOAT64;
+    return true;
+}
+
+// Empty fields are nulls. *fits is false when the value matches neither the
+// column type nor (for int64) float64; the row is then stored as null and the
+// caller re-parses with the column as strings.
+static bool column_append_typed(cisv_column_t *col, const char *s, size_t len, bool *fits) {
+    *fits = true;
+    if (len == 0) return column_append_null(col);
+    if (!column_ensure_rows(col)) return false;
+
+    if (!column_store_typed(col, col->length, s, len)) {
+        double v;
+        if (col->type == CISV_TYPE_INT64 && parse_float64_field(s, len, &v) &&
+            !integer_exceeds_float64(s, len) && column_widen_to_float(col)) {
+            ((double *)col->data)[col->length] = v;
+        } else {
+            *fits = false;
+            return column_append_null(col);
+        }
+    }
+    column_set_valid(col, col->length);
+    col->length++;
+    return true;
+}
+
+// Most specific type every non-empty sampled value parses as
+static cisv_type_t column_infer_type(const cisv_column_t *col) {
+    enum { FIT_INT = 1, FIT_FLOAT = 2, FIT_BOOL = 4, FIT_DATE = 8 };
+    unsigned candidates = FIT_INT | FIT_FLOAT | FIT_BOOL | FIT_DATE;
+    bool seen = false;
+
+    for (size_t row = 0; row < col->length && candidates; row++) {
+        size_t len = 0;
+        const char *v = cisv_column_value(col, row, &len);
+        if (!v || len == 0) continue;
+        seen = true;
+
+        unsigned fits = 0;
+        int64_t i;
+        double f;
+        bool b;
+        int32_t d;
+        if ((candidates & FIT_INT) && parse_int64_field(v, len, &i)) {
+            fits |= FIT_INT;
+            if (i <= FLOAT64_EXACT_INT && i >= -FLOAT64_EXACT_INT) fits |= FIT_FLOAT;
+        } else if ((candidates & FIT_FLOAT) && parse_float64_field(v, len, &f) &&
+                   !integer_exceeds_float64(v, len)) {
+            fits |= FIT_FLOAT;
+        }
+        if ((candidates & FIT_BOOL) && parse_bool_field(v, len, &b)) fits |= FIT_BOOL;
+        if ((candidates & FIT_DATE) && parse_date_field(v, len, &d)) fits |= FIT_DATE;
+        candidates &= fits;
+    }
+
+    if (!seen) return CISV_TYPE_STRING;
+    if (candidates & FIT_INT) return CISV_TYPE_INT64;
+    if (candidates & FIT_FLOAT) return CISV_TYPE_FLOAT64;
+    if (candidates & FIT_BOOL) return CISV_TYPE_BOOL;
+    if (candidates & FIT_DATE) return CISV_TYPE_DATE;
+    return CISV_TYPE_STRING;
+}
+
+// Convert a sampled string column to native values and drop the strings
+static bool column_convert(cisv_column_t *col, cisv_type_t type) {
+    cisv_column_t typed = *col;
+    typed.type = type;
+    typed.data = NULL;
+    typed.capacity = 0;
+    if (!column_grow_data(&typed, col->capacity)) return false;
+    typed.capacity = col->capacity;
+
+    for (size_t row = 0; row < col->length; row++) {
+        size_t len = 0;
+        const char *v = cisv_column_value(col, row, &len);
+        if (!v) continue;
+        // Inference guarantees non-empty values fit
+        if (len == 0 || !column_store_typed(&typed, row, v, len)) {
+            if (!column_clear_valid(&typed, row)) {
+                if (typed.validity != col->validity) free(typed.validity);
+                free(typed.data);
+                return false;
+            }
+        }
+    }
+
+    free(col->offsets);
+    free(col->offsets64);
+    free(col->values);
+    typed.offsets = NULL;
+    typed.offsets64 = NULL;
+    typed.values = NULL;
+    typed.values_size = 0;
+    typed.values_capacity = 0;
+    *col = typed;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Dictionary columns
+// -----------------------------------------------------------------------------
+
+static inline uint64_t dict_hash(const char *s, size_t len) {
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ len;
+    while (len >= 8) {
+        uint64_t w;
+        memcpy(&w, s, 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+        s += 8;
+        len -= 8;
+    }
+    // Tail as two overlapping 4-byte loads (or first/middle/last byte), no
+    // variable-length copy
+    uint64_t w = 0;
+    if (len >= 4) {
+        uint32_t a, b;
+        memcpy(&a, s, 4);
+        memcpy(&b, s + len - 4, 4);
+        w = ((uint64_t)a << 32) | b;
+    } else if (len) {
+        w = (uint64_t)(uint8_t)s[0] | (uint64_t)(uint8_t)s[len / 2] << 8 |
+            (uint64_t)(uint8_t)s[len - 1] << 16;
+    }
+    h = (h ^ w) * 0xFF51AFD7ED558CCDULL;
+    return h ^ (h >> 29);
+}
+
+// Whether a sampled string column repeats enough to be worth a dictionary:
+// at most half of its present values distinct, and no more than the limit.
+// slots is scratch space here (row + 1 of each value's first occurrence).
+static bool column_dict_worthwhile(const cisv_column_t *col, uint32_t *slots) {
+    size_t present = col->length - col->null_count;
+    size_t limit = present / 2;
+    if (limit > COLUMNAR_DICT_MAX_VALUES) limit = COLUMNAR_DICT_MAX_VALUES;
+    if (limit == 0 || col->length >= UINT32_MAX) return false;
+
+    size_t distinct = 0;
+    for (size_t row = 0; row < col->length; row++) {
+        if (!cisv_column_is_valid(col, row)) continue;
+        size_t len = 0;
+        const char *v = cisv_column_value(col, row, &len);
+        if (!v) v = "";  // Empty values of an all-empty sample have no buffer
+
+        size_t i = (size_t)dict_hash(v, len) & (COLUMNAR_DICT_SLOTS - 1);
+        for (; slots[i]; i = (i + 1) & (COLUMNAR_DICT_SLOTS - 1)) {
+            size_t seen_len = 0;
+            const char *seen = cisv_column_value(col, slots[i] - 1, &seen_len);
+            if (seen_len == len && (len == 0 || memcmp(seen, v, len) == 0)) break;
+        }
+        if (!slots[i]) {
+            if (++distinct > limit) return false;
+            slots[i] = (uint32_t)row + 1;
+        }
+    }
+    return true;
+}
+
+// Code of a value, added to the dictionary if new. *full is set instead when
+// a new value would pass the limit (or 32-bit offsets); false on OOM only.
+static bool column_dict_code(cisv_column_t *col, uint32_t *slots, const char *s, size_t len,
+                             uint32_t *code, bool *full) {
+    size_t i = (size_t)dict_hash(s, len) & (COLUMNAR_DICT_SLOTS - 1);
+    for (; slots[i]; i = (i + 1) & (COLUMNAR_DICT_SLOTS - 1)) {
+        uint32_t c = slots[i] - 1;
+        size_t start = (size_t)col->offsets[c];
+        if ((size_t)col->offsets[c + 1] - start == len && memcmp(col->values + start, s, len) == 0) {
+            *code = c;
+            return true;
+        }
+    }
+
+    size_t needed = col->values_size + len;
+    if (col->dict_size == COLUMNAR_DICT_MAX_VALUES || needed > INT32_MAX) {
+        *full = true;
+        return true;
+    }
+    if (!column_reserve_values(col, needed)) return false;
+
+    memcpy(col->values + col->values_size, s, len);
+    col->values_size = needed;
+    *code = (uint32_t)col->dict_size++;
+    col->offsets[col->dict_size] = (int32_t)needed;
+    slots[i] = (uint32_t)col->dict_size;
+    return true;
+}
+
+// Empty dictionary: room for every offset up to the limit, codes as data.
+// values is allocated up front so an empty value never reads as a null.
+static bool column_dict_init(cisv_column_t *col) {
+    if (!column_reserve_values(col, 1)) return false;
+    col->offsets = malloc((COLUMNAR_DICT_MAX_VALUES + 1) * sizeof(int32_t));
+    if (!col->offsets) return false;
+    col->offsets[0] = 0;
+    col->offset_width = 4;
+    col->type = CISV_TYPE_DICT;
+    return true;
+}
+
+// Re-encode a sampled string column as a dictionary
+static bool column_to_dict(cisv_column_t *col, uint32_t *slots) {
+    cisv_column_t dict = *col;
+    dict.data = NULL;
+    dict.offsets64 = NULL;
+    dict.values = NULL;
+    dict.values_size = 0;
+    dict.values_capacity = 0;
+    dict.dict_size = 0;
+    if (!column_dict_init(&dict)) {
+        free(dict.values);
+        return false;
+    }
+    dict.capacity = 0;
+    if (!column_grow_data(&dict, col->capacity)) {
+        free(dict.offsets);
+        free(dict.values);
+        return false;
+    }
+    dict.capacity = col->capacity;
+
+    uint32_t *codes = (uint32_t *)dict.data;
+    for (size_t row = 0; row < col->length; row++) {
+        if (!cisv_column_is_valid(col, row)) continue;
+        size_t len = 0;
+        const char *v = cisv_column_value(col, row, &len);
+        if (!v) v = "";
+        bool full = false;
+        // The sample was counted first, so the dictionary cannot fill up
+        if (!column_dict_code(&dict, slots, v, len, &codes[row], &full) || full) {
+            free(dict.offsets);
+            free(dict.values);
+            free(dict.data);
+            return false;
+        }
+    }
+
+    free(col->offsets);
+    free(col->offsets64);
+    free(col->values);
+    *col = dict;
+    return true;
+}
+
+// Back to plain strings once a dictionary outgrows its limit
+static bool column_dict_expand(cisv_column_t *col) {
+    const uint32_t *codes = (const uint32_t *)col->data;
+    size_t total = 0;
+    for (size_t row = 0; row < col->length; row++) {
+        if (cisv_column_is_valid(col, row)) {
+            total += (size_t)(col->offsets[codes[row] + 1] - col->offsets[codes[row]]);
+        }
+    }
+
+    cisv_column_t plain = *col;
+    plain.type = CISV_TYPE_STRING;
+    plain.data = NULL;
+    plain.offsets = NULL;
+    plain.offset_width = total > INT32_MAX ? 8 : 4;
+    plain.values = malloc(total ? total : 1);
+    plain.values_size = 0;
+    plain.values_capacity = total ? total : 1;
+    plain.dict_size = 0;
+    if (plain.offset_width == 4) {
+        plain.offsets = malloc(col->capacity * sizeof(int32_t));
+    } else {
+        plain.offsets64 = malloc(col->capacity * sizeof(int64_t));
+    }
+    if (!plain.values || (!plain.offsets && !plain.offsets64)) {
+        free(plain.values);
+        free(plain.offsets);
+        free(plain.offsets64);
+        return false;
+    }
+
+    column_set_offset(&plain, 0, 0);
+    for (size_t row = 0; row < col->length; row++) {
+        if (cisv_column_is_valid(col, row)) {
+            size_t start = (size_t)col->offsets[codes[row]];
+            size_t len = (size_t)col->offsets[codes[row] + 1] - start;
+            memcpy(plain.values + plain.values_size, col->values + start, len);
+            plain.values_size += len;
+        }
+        column_set_offset(&plain, row + 1, plain.values_size);
+    }
+
+    free(col->offsets);
+    free(col->values);
+    free(col->data);
+    *col = plain;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Collector
+// -----------------------------------------------------------------------------
+
+// Hash table of a dictionary column, allocated on first use
+static uint32_t *columnar_dict_slots(ColumnarCollector *cc, size_t index) {
+    if (index >= cc->dict_slots_capacity) {
+        size_t new_cap = cc->dict_slots_capacity ? cc->dict_slots_capacity * 2 : COLUMNAR_INITIAL_COLUMNS;
+        while (new_cap <= index) new_cap *= 2;
+        uint32_t **slots = realloc(cc->dict_slots, new_cap * sizeof(uint32_t *));
+        if (!slots) return NULL;
+        memset(slots + cc->dict_slots_capacity, 0,
+               (new_cap - cc->dict_slots_capacity) * sizeof(uint32_t *));
+        cc->dict_slots = slots;
+        cc->dict_slots_capacity = new_cap;
+    }
+    if (!cc->dict_slots[index]) {
+        cc->dict_slots[index] = calloc(COLUMNAR_DICT_SLOTS, sizeof(uint32_t));
+    }
+    return cc->dict_slots[index];
+}
+
+static void columnar_drop_dict(ColumnarCollector *cc, size_t index) {
+    if (index < cc->dict_slots_capacity) {
+        free(cc->dict_slots[index]);
+        cc->dict_slots[index] = NULL;
+    }
+}
+
+static void columnar_free_dicts(ColumnarCollector *cc) {
+    for (size_t i = 0; i < cc->dict_slots_capacity; i++) {
+        free(cc->dict_slots[i]);
+    }
+    free(cc->dict_slots);
+    cc->dict_slots = NULL;
+    cc->dict_slots_capacity = 0;
+}
+
+// Append to a dictionary column, expanding it to strings when it fills up
+static bool columnar_dict_append(ColumnarCollector *cc, size_t index, cisv_column_t *col,
+                                 const char *data, size_t len) {
+    uint32_t *slots = columnar_dict_slots(cc, index);
+    if (!slots || !column_ensure_rows(col)) return false;
+
+    uint32_t code;
+    bool full = false;
+    if (!column_dict_code(col, slots, data, len, &code, &full)) return false;
+    if (full) {
+        columnar_drop_dict(cc, index);
+        return column_dict_expand(col) && column_append(col, data, len);
+    }
+    ((uint32_t *)col->data)[col->length] = code;
+    column_set_valid(col, col->length);
+    col->length++;
+    return true;
+}
+
+// Add a column for a row wider than any before it; earlier rows are null
+static cisv_column_t *columnar_add_column(ColumnarCollector *cc) {
+    cisv_columnar_t *r = cc->result;
+    if (r->column_count == r->column_capacity) {
+        size_t new_cap = r->column_capacity ? r->column_capacity * 2 : COLUMNAR_INITIAL_COLUMNS;
+        cisv_column_t *columns = realloc(r->columns, new_cap * sizeof(cisv_column_t));
+        if (!columns) return NULL;
+        r->columns = columns;
+        r->column_capacity = new_cap;
+    }
+
+    size_t index = r->column_count;
+    cisv_column_t *col = &r->columns[index];
+    memset(col, 0, sizeof(*col));
+    col->offset_width = 4;
+    if (cc->types_fixed && cc->forced && index < cc->forced_count) {
+        col->type = cc->forced[index];
+        if (col->type == CISV_TYPE_DICT && !column_dict_init(col)) return NULL;
+    }
+    if (!column_ensure_rows(col)) return NULL;
+    if (col->type == CISV_TYPE_STRING) {
+        // As for dictionaries, an all-empty column must not read as null
+        if (!column_reserve_values(col, 1)) return NULL;
+        col->offsets[0] = 0;
+    }
+    r->column_count++;
+
+    for (size_t i = 0; i < r->row_count; i++) {
+        if (!column_append_null(col)) return NULL;
+    }
+    return col;
+}
+
+static void columnar_oom(cisv_columnar_t *r) {
+    if (r->error_code == 0) {
+        r->error_code = -ENOMEM;
+        snprintf(r->error_message, sizeof(r->error_message), "Out of memory (columns)");
+    }
+}
+
+static bool columnar_add_name(ColumnarCollector *cc, const char *data, size_t len) {
+    cisv_columnar_t *r = cc->result;
+    char **names = realloc(r->names, (r->name_count + 1) * sizeof(char *));
+    if (!names) return false;
+    r->names = names;
+
+    char *name = malloc(len + 1);
+    if (!name) return false;
+    memcpy(name, data, len);
+    name[len] = '\0';
+    r->names[r->name_count++] = name;
+    return true;
+}
+
+static void columnar_mark_mismatch(ColumnarCollector *cc, size_t index) {
+    if (index >= cc->mismatch_capacity) {
+        size_t new_cap = cc->mismatch_capacity ? cc->mismatch_capacity * 2 : COLUMNAR_INITIAL_COLUMNS;
+        while (new_cap <= index) new_cap *= 2;
+        bool *mismatch = realloc(cc->mismatch, new_cap * sizeof(bool));
+        if (!mismatch) {
+            columnar_oom(cc->result);
+            return;
+        }
+        memset(mismatch + cc->mismatch_capacity, 0, (new_cap - cc->mismatch_capacity) * sizeof(bool));
+        cc->mismatch = mismatch;
+        cc->mismatch_capacity = new_cap;
+    }
+    cc->mismatch[index] = true;
+}
+
+// End of the sample: pick a type per column and convert what was collected
+static void columnar_fix_types(ColumnarCollector *cc) {
+    cisv_columnar_t *r = cc->result;
+    cc->types_fixed = true;
+    for (size_t i = 0; i < r->column_count; i++) {
+        cisv_column_t *col = &r->columns[i];
+        cisv_type_t type = column_infer_type(col);
+        if (type != CISV_TYPE_STRING) {
+            if (!column_convert(col, type)) columnar_oom(r);
+            continue;
+        }
+        if (!cc->dictionary_encode || col->length - col->null_count < 2) continue;
+
+        uint32_t *slots = columnar_dict_slots(cc, i);
+        if (!slots) {
+            columnar_oom(r);
+        } else if (column_dict_worthwhile(col, slots)) {
+            memset(slots, 0, COLUMNAR_DICT_SLOTS * sizeof(uint32_t));
+            if (!column_to_dict(col, slots)) columnar_oom(r);
+        } else {
+            columnar_drop_dict(cc, i);
+        }
+    }
+}
+
+static void columnar_field_cb(void *user, const char *data, size_t len) {
+    ColumnarCollector *cc = (ColumnarCollector *)user;
+    cisv_columnar_t *r = cc->result;
+
+    if (cc->header) {
+        if (!columnar_add_name(cc, data, len)) columnar_oom(r);
+        return;
+    }
+
+    size_t index = cc->current_col++;
+    cisv_column_t *col;
+    if (index < r->column_count) {
+        col = &r->columns[index];
+    } else {
+        col = columnar_add_column(cc);
+        if (!col) {
+            columnar_oom(r);
+            return;
+        }
+    }
+
+    bool ok;
+    if (col->type == CISV_TYPE_STRING) {
+        ok = column_append(col, data, len);
+    } else if (col->type == CISV_TYPE_DICT) {
+        ok = columnar_dict_append(cc, index, col, data, len);
+    } else {
+        bool fits;
+        ok = column_append_typed(col, data, len, &fits);
+        if (!fits) columnar_mark_mismatch(cc, index);
+    }
+    if (!ok) columnar_oom(r);
+}
+
+// Rows shorter than the widest one so far get nulls in the missing columns
+static void columnar_row_cb(void *user) {
+    ColumnarCollector *cc = (ColumnarCollector *)user;
+    cisv_columnar_t *r = cc->result;
+
+    if (cc->header) {
+        // Every named column exists even if no data row reaches it
+        cc->header = false;
+        while (r->column_count < r->name_count) {
+            if (!columnar_add_column(cc)) {
+                columnar_oom(r);
+                break;
+            }
+        }
+        return;
+    }
+
+    for (size_t i = cc->current_col; i < r->column_count; i++) {
+        if (!column_append_null(&r->columns[i])) {
+            columnar_oom(r);
+        }
+    }
+    r->row_count++;
+    cc->current_col = 0;
+
+    if (cc->typed && !cc->types_fixed && r->row_count >= cc->infer_rows) {
+        columnar_fix_types(cc);
+    }
+}
+
+static void columnar_error_cb(void *user, int line, const char *msg) {
+    ColumnarCollector *cc = (ColumnarCollector *)user;
+    cisv_columnar_t *r = cc->result;
+
+    if (r->error_code == 0) {
+        r->error_code = -1;
+        snprintf(r->error_message, sizeof(r->error_message),
+                 "Parse error at line %d: %s", line, msg ? msg : "unknown error");
+    }
+}
+
+void cisv_columnar_free(cisv_columnar_t *result) {
+    if (!result) return;
+
+    for (size_t i = 0; i < result->column_count; i++) {
+        cisv_column_t *col = &result->columns[i];
+        free(col->offsets);
+        free(col->offsets64);
+        free(col->values);
+        free(col->data);
+        free(col->validity);
+    }
+    for (size_t i = 0; i < result->name_count; i++) {
+        free(result->names[i]);
+    }
+    free(result->names);
+    free(result->columns);
+    free(result);
+}
+
+bool cisv_column_is_valid(const cisv_column_t *column, size_t row) {
+    if (!column || row >= column->length) return false;
+    return !column->validity || (column->validity[row >> 3] & (1u << (row & 7)));
+}
+
+const char *cisv_column_value(const cisv_column_t *column, size_t row, size_t *len) {
+    if (!column || !cisv_column_is_valid(column, row)) return NULL;
+
+    if (column->type == CISV_TYPE_DICT) {
+        uint32_t code = ((const uint32_t *)column->data)[row];
+        size_t start = (size_t)column->offsets[code];
+        if (len) *len = (size_t)column->offsets[code + 1] - start;
+        return column->values + start;
+    }
+    if (column->type != CISV_TYPE_STRING) return NULL;
+
+    size_t start = column_offset(column, row);
+    if (len) *len = column_offset(column, row + 1) - start;
+    return column->values + start;
+}
+
+// One parse of a file (path) or buffer (data) into a columnar result
+static cisv_columnar_t *columnar_parse_once(ColumnarCollector *cc, const char *path,
+                                            const char *data, size_t len,
+                                            const cisv_config *config) {
+    cisv_columnar_t *result = calloc(1, sizeof(cisv_columnar_t));
+    if (!result) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    cc->result = result;
+
+    cisv_config columnar_config;
+    if (config) {
+        columnar_config = *config;
+    } else {
+        cisv_config_init(&columnar_config);
+    }
+    columnar_config.field_cb = columnar_field_cb;
+    columnar_config.row_cb = columnar_row_cb;
+    columnar_config.error_cb = columnar_error_cb;
+    columnar_config.user = cc;
+    columnar_config.release_cb = NULL;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&columnar_config);
+    if (!parser) {
+        cisv_columnar_free(result);
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    if (path) {
+        int parse_result = cisv_parser_parse_file(parser, path);
+        if (parse_result < 0) {
+            result->error_code = parse_result;
+            snprintf(result->error_message, sizeof(result->error_message),
+                     "Failed to parse file: %s", strerror(-parse_result));
+        }
+    } else {
+        cisv_parser_write(parser, (const uint8_t *)data, len);
+        cisv_parser_end(parser);
+    }
+    cisv_parser_destroy(parser);
+
+    // Inputs shorter than the sample still get their types
+    if (cc->typed && !cc->types_fixed) {
+        columnar_fix_types(cc);
+    }
+    columnar_free_dicts(cc);
+    return result;
+}
+
+// Typed parses repeat with the offending columns forced to strings when a
+// value after the sample does not fit; every such column is found in one
+// pass, so this normally takes a single extra pass at most
+static cisv_columnar_t *columnar_parse(const char *path, const char *data, size_t len,
+                                       const cisv_config *config, bool typed,
+                                       bool header, size_t infer_rows) {
+    cisv_type_t *forced = NULL;
+    size_t forced_count = 0;
+
+    for (;;) {
+        ColumnarCollector cc = {
+            .typed = typed,
+            .types_fixed = forced != NULL,
+            .infer_rows = infer_rows ? infer_rows : COLUMNAR_INFER_ROWS,
+            .forced = forced,
+            .forced_count = forced_count,
+            .dictionary_encode = config && config->dictionary_encode,
+            .header = header,
+        };
+        cisv_columnar_t *result = columnar_parse_once(&cc, path, data, len, config);
+
+        bool retry = false;
+        for (size_t i = 0; result && i < cc.mismatch_capacity && i < result->column_count; i++) {
+            retry = retry || cc.mismatch[i];
+        }
+        if (!retry) {
+            free(cc.mismatch);
+            free(forced);
+            return result;
+        }
+
+        cisv_type_t *types = malloc(result->column_count * sizeof(cisv_type_t));
+        if (!types) {
+            free(cc.mismatch);
+            free(forced);
+            cisv_columnar_free(result);
+            errno = ENOMEM;
+            return NULL;
+        }
+        for (size_t i = 0; i < result->column_count; i++) {
+            bool bad = i < cc.mismatch_capacity && cc.mismatch[i];
+            types[i] = bad ? CISV_TYPE_STRING : result->columns[i].type;
+        }
+        free(forced);
+        forced = types;
+        forced_count = result->column_count;
+        free(cc.mismatch);
+        cisv_columnar_free(result);
+    }
+}
+
+cisv_columnar_t *cisv_parse_file_columnar(const char *path, const cisv_config *config) {
+    if (!path) {
+        errno = EINVAL;
+        return NULL;
+    }
+    return columnar_parse(path, NULL, 0, config, false, false, 0);
+}
+
+cisv_columnar_t *cisv_parse_string_columnar(const char *data, size_t len,
+                                            const cisv_config *config) {
+    if (!data) {
+        errno = EINVAL;
+        return NULL;
+    }
+    return columnar_parse(NULL, data, len, config, false, false, 0);
+}
+
+cisv_columnar_t *cisv_parse_file_typed(const char *path, const cisv_config *config,
+                                       bool header, size_t infer_rows) {
+    if (!path) {
+        errno = EINVAL;
+        return NULL;
+    }
+    return columnar_parse(path, NULL, 0, config, true, header, infer_rows);
+}
+
+cisv_columnar_t *cisv_parse_string_typed(const char *data, size_t len,
+                                         const cisv_config *config,
+                                         bool header, size_t infer_rows) {
+    if (!data) {
+        errno = EINVAL;
+        return NULL;
+    }
+    return columnar_parse(NULL, data, len, config, true, header, infer_rows);
+}
+
+// =============================================================================
+// Arrow C Data Interface Export Implementation
+// Every exported child array owns its own buffers so a consumer may move
+// children out and release them independently of the parent
+// =============================================================================
+
+typedef struct {
+    const void *buffers[3];      // validity, offsets, values
+    struct ArrowArray *dictionary; // Values of a dictionary column (own private data)
+} ArrowColumnPrivate;
+
+typedef struct {
+    const void *buffers[1];      // struct validity (always NULL)
+    struct ArrowArray **children;
+    struct ArrowArray *child_storage;
+} ArrowTablePrivate;
+
+typedef struct {
+    struct ArrowSchema **children;
+    struct ArrowSchema *child_storage;
+} ArrowSchemaPrivate;
+
+static void arrow_column_release(struct ArrowArray *array) {
+    ArrowColumnPrivate *priv = (ArrowColumnPrivate *)array->private_data;
+    for (int i = 0; i < 3; i++) {
+        free((void *)priv->buffers[i]);
+    }
+    if (priv->dictionary) {
+        if (priv->dictionary->release) priv->dictionary->release(priv->dictionary);
+        free(priv->dictionary);
+    }
+    free(priv);
+    array->release = NULL;
+}
+
+static void arrow_table_release(struct ArrowArray *array) {
+    ArrowTablePrivate *priv = (ArrowTablePrivate *)array->private_data;
+    for (int64_t i = 0; i < array->n_children; i++) {
+        struct ArrowArray *child = priv->children[i];
+        if (child->release) child->release(child);
+    }
+    free(priv->children);
+    free(priv->child_storage);
+    free(priv);
+    array->release = NULL;
+}
+
+static void arrow_dict_schema_release(struct ArrowSchema *schema) {
+    schema->release = NULL;
+}
+
+static void arrow_field_schema_release(struct ArrowSchema *schema) {
+    if (schema->dictionary) {
+        if (schema->dictionary->release) schema->dictionary->release(schema->dictionary);
+        free(schema->dictionary);
+    }
+    free((void *)schema->name);
+    schema->release = NULL;
+}
+
+static void arrow_table_schema_release(struct ArrowSchema *schema) {
+    ArrowSchemaPrivate *priv = (ArrowSchemaPrivate *)schema->private_data;
+    for (int64_t i = 0; i < schema->n_children; i++) {
+        struct ArrowSchema *child = priv->children[i];
+        if (child->release) child->release(child);
+    }
+    free(priv->children);
+    free(priv->child_storage);
+    free(priv);
+    schema->release = NULL;
+}
+
+static char *arrow_column_name(const cisv_columnar_t *result, size_t index, bool header) {
+    size_t len = 0;
+    const char *value = NULL;
+    if (result->names) {
+        if (index < result->name_count && result->names[index]) {
+            value = result->names[index];
+            len = strlen(value);
+        }
+    } else if (header) {
+        value = cisv_column_value(&result->columns[index], 0, &len);
+    }
+    char *name;
+    if (value) {
+        name = malloc(len + 1);
+        if (name) {
+            memcpy(name, value, len);
+            name[len] = '\0';
+        }
+    } else {
+        name = malloc(32);
+        if (name) snprintf(name, 32, "column_%zu", index);
+    }
+    return name;
+}
+
+static const char *arrow_format(const cisv_column_t *col) {
+    switch (col->type) {
+        case CISV_TYPE_INT64: return "l";
+        case CISV_TYPE_FLOAT64: return "g";
+        case CISV_TYPE_BOOL: return "b";
+        case CISV_TYPE_DATE: return "tdD";
+        case CISV_TYPE_DICT: return "I";
+        default: return col->offset_width == 4 ? "u" : "U";
+    }
+}
+
+int cisv_columnar_export_arrow(cisv_columnar_t *result, bool header,
+                               struct ArrowSchema *schema, struct ArrowArray *array) {
+    if (!result || !schema || !array) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    size_t ncols = result->column_count;
+    size_t skip = (header && !result->names && result->row_count > 0) ? 1 : 0;
+
+    // Allocate all metadata up front so nothing is moved unless export succeeds
+    ArrowTablePrivate *table = calloc(1, sizeof(ArrowTablePrivate));
+    ArrowSchemaPrivate *fields = calloc(1, sizeof(ArrowSchemaPrivate));
+    ArrowColumnPrivate **cols = calloc(ncols + 1, sizeof(ArrowColumnPrivate *));
+    struct ArrowSchema **dicts = calloc(ncols + 1, sizeof(struct ArrowSchema *));
+    char **names = calloc(ncols + 1, sizeof(char *));
+    bool ok = table && fields && cols && dicts && names;
+    if (ok) {
+        table->children = calloc(ncols + 1, sizeof(struct ArrowArray *));
+        table->child_storage = calloc(ncols + 1, sizeof(struct ArrowArray));
+        fields->children = calloc(ncols + 1, sizeof(struct ArrowSchema *));
+        fields->child_storage = calloc(ncols + 1, sizeof(struct ArrowSchema));
+        ok = table->children && table->child_storage && fields->children && fields->child_storage;
+    }
+    for (size_t i = 0; ok && i < ncols; i++) {
+        cols[i] = calloc(1, sizeof(ArrowColumnPrivate));
+        names[i] = arrow_column_name(result, i, skip > 0);
+        ok = cols[i] && names[i];
+        // Arrow allows a NULL values buffer only when it is empty; some
+        // consumers still dereference it
+        if (ok && result->columns[i].type == CISV_TYPE_STRING && !result->columns[i].values) {
+            result->columns[i].values = malloc(1);
+            ok = result->columns[i].values != NULL;
+        }
+        if (ok && result->columns[i].type == CISV_TYPE_DICT) {
+            cols[i]->dictionary = calloc(1, sizeof(struct ArrowArray));
+            dicts[i] = calloc(1, sizeof(struct ArrowSchema));
+            ok = cols[i]->dictionary && dicts[i];
+            if (ok) {
+                cols[i]->dictionary->private_data = calloc(1, sizeof(ArrowColumnPrivate));
+                ok = cols[i]->dictionary->private_data != NULL;
+            }
+        }
+    }
+    if (!ok) {
+        for (size_t i = 0; cols && dicts && names && i < ncols; i++) {
+            if (cols[i] && cols[i]->dictionary) {
+                free(cols[i]->dictionary->private_data);
+                free(cols[i]->dictionary);
+            }
+            free(cols[i]);
+            free(dicts[i]);
+            free(names[i]);
+        }
+        free(cols);
+        free(dicts);
+        free(names);
+        if (table) {
+            free(table->children);
+            free(table->child_storage);
+        }
+        if (fields) {
+            free(fields->children);
+            free(fields->child_storage);
+        }
+        free(table);
+        free(fields);
+        errno = ENOMEM;
+        return -1;
+    }
+
+    memset(schema, 0, sizeof(*schema));
+    memset(array, 0, sizeof(*array));
+
+    for (size_t i = 0; i < ncols; i++) {
+        cisv_column_t *col = &result->columns[i];
+        struct ArrowArray *child = &table->child_storage[i];
+        struct ArrowSchema *field = &fields->child_storage[i];
+        bool header_null = skip && !cisv_column_is_valid(col, 0);
+
+        // Buffers move to the child; the header row stays behind the offset
+        cols[i]->buffers[0] = col->validity;
+        if (col->type == CISV_TYPE_STRING) {
+            cols[i]->buffers[1] = col->offset_width == 4 ? (const void *)col->offsets
+                                                         : (const void *)col->offsets64;
+            cols[i]->buffers[2] = col->values;
+        } else {
+            cols[i]->buffers[1] = col->data;
+        }
+        if (col->type == CISV_TYPE_DICT) {
+            // Codes stay in the child, the distinct values become its dictionary
+            struct ArrowArray *dict = cols[i]->dictionary;
+            ArrowColumnPrivate *dict_priv = (ArrowColumnPrivate *)dict->private_data;
+            dict_priv->buffers[1] = col->offsets;
+            dict_priv->buffers[2] = col->values;
+            dict->length = (int64_t)col->dict_size;
+            dict->n_buffers = 3;
+            dict->buffers = dict_priv->buffers;
+            dict->release = arrow_column_release;
+            child->dictionary = dict;
+
+            dicts[i]->format = "u";
+            dicts[i]->name = "";
+            dicts[i]->release = arrow_dict_schema_release;
+            field->dictionary = dicts[i];
+        }
+        child->length = (int64_t)(col->length - skip);
+        child->null_count = (int64_t)(col->null_count - (header_null ? 1 : 0));
+        child->offset = (int64_t)skip;
+        child->n_buffers = col->type == CISV_TYPE_STRING ? 3 : 2;
+        child->buffers = cols[i]->buffers;
+        child->release = arrow_column_release;
+        child->private_data = cols[i];
+        table->children[i] = child;
+
+        field->format = arrow_format(col);
+        field->name = names[i];
+        field->flags = ARROW_FLAG_NULLABLE;
+        field->release = arrow_field_schema_release;
+        fields->children[i] = field;
+
+        col->validity = NULL;
+        col->offsets = NULL;
+        col->offsets64 = NULL;
+        col->values = NULL;
+        col->data = NULL;
+    }
+
+    array->length = (int64_t)(result->row_count - skip);
+    array->n_buffers = 1;
+    array->n_children = (int64_t)ncols;
+    array->buffers = table->buffers;
+    array->children = table->children;
+    array->release = arrow_table_release;
+    array->private_data = table;
+
+    schema->format = "+s";
+    schema->name = "";
+    schema->n_children = (int64_t)ncols;
+    schema->children = fields->children;
+    schema->release = arrow_table_schema_release;
+    schema->private_data = fields;
+
+    free(cols);
+    free(dicts);
+    free(names);
+    cisv_columnar_free(result);
+    return 0;
+}
+
+int cisv_parse_file_arrow(const char *path, const cisv_config *config, bool header,
+                          struct ArrowSchema *schema, struct ArrowArray *array) {
+    cisv_columnar_t *result = cisv_parse_file_columnar(path, config);
+    if (!result) return -1;
+
+    if (result->error_code < -1) {
+        // Negative errno from the file parse or an allocation failure
+        errno = -result->error_code;
+        cisv_columnar_free(result);
+        return -1;
+    }
+    if (result->error_code != 0 && config && config->error_cb) {
+        // Recoverable parse errors keep the rows, as with the other parse APIs
+        config->error_cb(config->user, 0, result->error_message);
+    }
+
+    if (cisv_columnar_export_arrow(result, header, schema, array) < 0) {
+        int saved = errno;
+        cisv_columnar_free(result);
+        errno = saved;
+        return -1;
+    }
+    return 0;
+}
+
+// =============================================================================
+// Parallel Batch Parsing Implementation
+// =============================================================================
+
+#include <pthread.h>
+
+// Thread argument for parallel parsing
+typedef struct {
+    const cisv_chunk_t *chunk;
+    const cisv_config *config;
+    cisv_result_t *result;
+    size_t chunk_size_hint;
+    bool ended_on_row;           // Parse finished exactly at a row boundary
+} ParallelParseArg;
+
+// Thread function for parallel parsing
+static void *parallel_parse_thread(void *arg) {
+    ParallelParseArg *parg = (ParallelParseArg *)arg;
+
+    cisv_result_t *result = batch_result_create_with_hint(parg->chunk_size_hint);
+    if (!result) {
+        parg->result = NULL;
+        return NULL;
+    }
+
+    BatchCollector bc = {
+        .result = result,
+        .current_row_start = 0
+    };
+
+    // Create config with batch callbacks
+    cisv_config batch_config;
+    if (parg->config) {
+        batch_config = *parg->config;
+    } else {
+        cisv_config_init(&batch_config);
+    }
+    batch_config.field_cb = batch_field_cb;
+    batch_config.row_cb = batch_row_cb;
+    batch_config.error_cb = batch_error_cb;
+    batch_config.user = &bc;
+    batch_config.release_cb = NULL;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&batch_config);
+    if (!parser) {
+        cisv_result_free(result);
+        parg->result = NULL;
+        return NULL;
+    }
+
+    cisv_parse_chunk(parser, parg->chunk);
+    // Every parse loop leaves field_start just past the last separator it
+    // consumed outside quotes, so this holds only when the chunk's final
+    // newline really ended a row under this parser's quoting rules
+    parg->ended_on_row = parser->state == S_NORMAL && parser->field_start == parg->chunk->end;
+    cisv_parser_destroy(parser);
+
+    // Convert stored indices to actual pointers now that parsing is complete
+    batch_result_finalize(result);
+
+    parg->result = result;
+    return NULL;
+}
+
+// Get number of available CPUs
+static int get_cpu_count(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count > 0) return (int)count;
+#endif
+    return 4;  // Default fallback
+}
+
+// =============================================================================
+// Work-Stealing Thread Pool
+// Files are split into morsels; each worker drains its own deque in file
+// order and steals from the far end of other deques when it runs dry, so a
+// slow morsel no longer holds up a whole equal-sized chunk
+// =============================================================================
+
+#define POOL_MAX_THREADS 64
+#define POOL_MORSEL_MIN (1024 * 1024)         // 1MB
+#define POOL_MORSEL_MAX (16 * 1024 * 1024)    // 16MB
+#define POOL_MORSELS_PER_THREAD 4
+
+// A job runs fn(ctx, i) for every i in [0, count)
+typedef struct cisv_pool_job {
+    void (*fn)(void *ctx, int index);
+    void *ctx;
+    size_t remaining;            // Tasks not yet finished (protected by lock)
+    pthread_mutex_t lock;
+    pthread_cond_t done;
+
+    // Capped job: fn is pool_lane_task, and each lane runs lane_fn for the
+    // next unclaimed index until lane_count are taken
+    void (*lane_fn)(void *ctx, int index);
+    void *lane_ctx;
+    int lane_count;
+    int lane_next;               // Next unclaimed index (atomic)
+} cisv_pool_job;
+
+typedef struct {
+    cisv_pool_job *job;
+    int index;                   // Task index (morsel index = result slot)
+} cisv_pool_task;
+
+// Per-worker deque: owner pops the front, thieves take the back
+typedef struct {
+    pthread_mutex_t lock;
+    cisv_pool_task *tasks;       // Ring buffer
+    size_t head;
+    size_t count;
+    size_t capacity;
+} cisv_pool_deque;
+
+typedef struct {
+    cisv_pool_t *pool;
+    int index;
+} cisv_pool_worker;
+
+struct cisv_pool {
+    int num_threads;             // Workers (one deque each)
+    int started;                 // Workers to join on destroy
+    int deque_count;             // Allocated deques
+    pthread_t *threads;
+    cisv_pool_worker *workers;
+    cisv_pool_deque *deques;
+
+    pthread_mutex_t lock;        // Guards sleeping and shutdown
+    pthread_cond_t work;
+    size_t queued;               // Tasks in all deques (atomic)
+    int next_worker;             // Rotates the first deque of each job
+    bool shutdown;
+};
+
+// Pool whose worker is running on this thread (NULL on other threads)
+static _Thread_local cisv_pool_t *pool_self;
+
+// Most workers a job submitted from this thread to pool_width_pool may
+// occupy; lets callers share a pool larger than they asked for
+static _Thread_local const cisv_pool_t *pool_width_pool;
+static _Thread_local int pool_width;
+
+static inline int pool_parallelism(const cisv_pool_t *pool) {
+    return pool == pool_width_pool && pool_width < pool->num_threads ? pool_width
+                                                                     : pool->num_threads;
+}
+
+static bool deque_push_back(cisv_pool_deque *d, cisv_pool_task task) {
+    pthread_mutex_lock(&d->lock);
+    if (d->count == d->capacity) {
+        size_t new_cap = d->capacity ? d->capacity * 2 : 64;
+        cisv_pool_task *tasks = malloc(new_cap * sizeof(cisv_pool_task));
+        if (!tasks) {
+            pthread_mutex_unlock(&d->lock);
+            return false;
+        }
+        for (size_t i = 0; i < d->count; i++) {
+            tasks[i] = d->tasks[(d->head + i) % d->capacity];
+        }
+        free(d->tasks);
+        d->tasks = tasks;
+        d->head = 0;
+        d->capacity = new_cap;
+    }
+    d->tasks[(d->head + d->count) % d->capacity] = task;
+    d->count++;
+    pthread_mutex_unlock(&d->lock);
+    return true;
+}
+
+static bool deque_pop_front(cisv_pool_deque *d, cisv_pool_task *out) {
+    pthread_mutex_lock(&d->lock);
+    bool found = d->count > 0;
+    if (found) {
+        *out = d->tasks[d->head];
+        d->head = (d->head + 1) % d->capacity;
+        d->count--;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+static bool deque_pop_back(cisv_pool_deque *d, cisv_pool_task *out) {
+    pthread_mutex_lock(&d->lock);
+    bool found = d->count > 0;
+    if (found) {
+        d->count--;
+        *out = d->tasks[(d->head + d->count) % d->capacity];
+    }
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+static bool pool_take(cisv_pool_t *pool, int self, cisv_pool_task *out) {
+    if (deque_pop_front(&pool->deques[self], out)) return true;
+
+    for (int i = 1; i < pool->num_threads; i++) {
+        int victim = (self + i) % pool->num_threads;
+        if (deque_pop_back(&pool->deques[victim], out)) return true;
+    }
+    return false;
+}
+
+static void pool_run_task(const cisv_pool_task *task) {
+    cisv_pool_job *job = task->job;
+    job->fn(job->ctx, task->index);
+
+    // The job lives on the submitter's stack: no access after unlocking
+    pthread_mutex_lock(&job->lock);
+    if (--job->remaining == 0) {
+        pthread_cond_signal(&job->done);
+    }
+    pthread_mutex_unlock(&job->lock);
+}
+
+static void *pool_worker_main(void *arg) {
+    cisv_pool_worker *worker = (cisv_pool_worker *)arg;
+    cisv_pool_t *pool = worker->pool;
+    pool_self = pool;
+
+    for (;;) {
+        cisv_pool_task task;
+        if (pool_take(pool, worker->index, &task)) {
+            __atomic_fetch_sub(&pool->queued, 1, __ATOMIC_ACQ_REL);
+            pool_run_task(&task);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        while (__atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) == 0 && !pool->shutdown) {
+            pthread_cond_wait(&pool->work, &pool->lock);
+        }
+        bool stop = pool->shutdown && __atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) == 0;
+        pthread_mutex_unlock(&pool->lock);
+        if (stop) break;
+    }
+    return NULL;
+}
+
+cisv_pool_t *cisv_pool_create(int num_threads) {
+    if (num_threads <= 0) {
+        num_threads = get_cpu_count();
+    }
+    if (num_threads > POOL_MAX_THREADS) num_threads = POOL_MAX_THREADS;
+
+    cisv_pool_t *pool = calloc(1, sizeof(cisv_pool_t));
+    if (!pool) {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    pool->threads = calloc(num_threads, sizeof(pthread_t));
+    pool->workers = calloc(num_threads, sizeof(cisv_pool_worker));
+    pool->deques = calloc(num_threads, sizeof(cisv_pool_deque));
+    if (!pool->threads || !pool->workers || !pool->deques) {
+        free(pool->threads);
+        free(pool->workers);
+        free(pool->deques);
+        free(pool);
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    for (int i = 0; i < num_threads; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+    }
+    pool->deque_count = num_threads;
+
+    // Workers read num_threads when stealing, so it is fixed before any starts
+    pool->num_threads = num_threads;
+    int started = 0;
+    for (int i = 0; i < num_threads; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        if (pthread_create(&pool->threads[i], NULL, pool_worker_main, &pool->workers[i]) != 0) {
+            break;
+        }
+        started++;
+    }
+
+    pool->started = started;
+
+    if (started < num_threads) {
+        cisv_pool_destroy(pool);
+        errno = EAGAIN;
+        return NULL;
+    }
+
+    return pool;
+}
+
+void cisv_pool_destroy(cisv_pool_t *pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->started; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    for (int i = 0; i < pool->deque_count; i++) {
+        free(pool->deques[i].tasks);
+        pthread_mutex_destroy(&pool->deques[i].lock);
+    }
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+
+    free(pool->threads);
+    free(pool->workers);
+    free(pool->deques);
+    free(pool);
+}
+
+int cisv_pool_size(const cisv_pool_t *pool) {
+    return pool ? pool->num_threads : 0;
+}
+
+static void pool_lane_task(void *ctx, int lane) {
+    (void)lane;
+    cisv_pool_job *job = (cisv_pool_job *)ctx;
+    int i;
+    while ((i = __atomic_fetch_add(&job->lane_next, 1, __ATOMIC_RELAXED)) < job->lane_count) {
+        job->lane_fn(job->lane_ctx, i);
+    }
+}
+
+// Queue fn(ctx, 0..count-1) on the pool without waiting; every submit is
+// paired with pool_job_wait. Contiguous index ranges per deque keep each
+// worker streaming through adjacent memory until it has to steal. Under a
+// pool_width cap the job is queued as that many lanes sharing the indices.
+static void pool_job_submit(cisv_pool_t *pool, cisv_pool_job *job,
+                            void (*fn)(void *, int), void *ctx, int count) {
+    if (count < 0) count = 0;
+    int width = pool_parallelism(pool);
+    if (count > width) {
+        job->lane_fn = fn;
+        job->lane_ctx = ctx;
+        job->lane_count = count;
+        job->lane_next = 0;
+        fn = pool_lane_task;
+        ctx = job;
+        count = width;
+    }
+    job->fn = fn;
+    job->ctx = ctx;
+    job->remaining = (size_t)count;
+    pthread_mutex_init(&job->lock, NULL);
+    pthread_cond_init(&job->done, NULL);
+    if (count == 0) return;
+
+    // A worker that queued a nested job and then waited for it could be
+    // waiting on itself (every worker may be doing the same), so jobs
+    // submitted from the pool's own workers run inline
+    if (pool_self == pool) {
+        for (int i = 0; i < count; i++) {
+            cisv_pool_task task = { .job = job, .index = i };
+            pool_run_task(&task);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    __atomic_fetch_add(&pool->queued, (size_t)count, __ATOMIC_ACQ_REL);
+    int first = pool->next_worker;
+    pool->next_worker = (first + 1) % pool->num_threads;
+    int queued = 0;
+    for (int i = 0; i < count; i++) {
+        int w = (first + (int)((size_t)i * pool->num_threads / count)) % pool->num_threads;
+        cisv_pool_task task = { .job = job, .index = i };
+        if (!deque_push_back(&pool->deques[w], task)) break;
+        queued++;
+    }
+    if (queued < count) {
+        __atomic_fetch_sub(&pool->queued, (size_t)(count - queued), __ATOMIC_ACQ_REL);
+    }
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
 
-    return 0;
+    // Tasks that could not be queued run on the calling thread
+    for (int i = queued; i < count; i++) {
+        cisv_pool_task task = { .job = job, .index = i };
+        pool_run_task(&task);
+    }
 }
 
-// =============================================================================
-// Batch Parsing Implementation
-// High-performance API that returns all data at once (no callbacks)
-// =============================================================================
+static void pool_job_wait(cisv_pool_job *job) {
+    pthread_mutex_lock(&job->lock);
+    while (job->remaining > 0) {
+        pthread_cond_wait(&job->done, &job->lock);
+    }
+    pthread_mutex_unlock(&job->lock);
 
-// Initial allocation sizes for batch parsing
-#define BATCH_INITIAL_ROWS 1024
-#define BATCH_INITIAL_FIELDS 8192
-#define BATCH_INITIAL_DATA (1024 * 1024)  // 1MB initial data buffer
+    pthread_cond_destroy(&job->done);
+    pthread_mutex_destroy(&job->lock);
+}
 
-// Internal collector for batch parsing
-typedef struct {
-    cisv_result_t *result;
-    size_t current_row_start;  // Index in all_fields where current row starts
-} BatchCollector;
+// Run fn(ctx, 0..count-1) on the pool and wait for all of them
+static void pool_run_job(cisv_pool_t *pool, void (*fn)(void *, int), void *ctx, int count) {
+    if (count <= 0) return;
+    if (count == 1) {
+        // Single task does not benefit from thread orchestration
+        fn(ctx, 0);
+        return;
+    }
 
-// Ensure result has capacity for more rows
-static inline bool batch_ensure_rows(cisv_result_t *r, size_t needed) {
-    if (r->row_count + needed <= r->row_capacity) return true;
+    cisv_pool_job job;
+    pool_job_submit(pool, &job, fn, ctx, count);
+    pool_job_wait(&job);
+}
 
-    // 1.5x growth: reduces memory waste from ~50% to ~33%
-    size_t required = r->row_count + needed;
-    size_t new_cap = r->row_capacity + (r->row_capacity >> 1);
-    if (new_cap < required) new_cap = required;
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    size_t range_size;
+    int range_count;
+    uint8_t quote;
+    chunk_scan_t *scans;
+} PoolScanJob;
+
+static void pool_scan_task(void *ctx, int index) {
+    PoolScanJob *job = (PoolScanJob *)ctx;
+    size_t start = (size_t)index * job->range_size;
+    size_t len = (index == job->range_count - 1) ? job->size - start : job->range_size;
+    chunk_scan(job->data + start, len, job->quote, &job->scans[index]);
+}
 
-    cisv_row_t *new_rows = realloc(r->rows, new_cap * sizeof(cisv_row_t));
-    if (!new_rows) return false;
+typedef struct {
+    const cisv_chunk_t *chunks;
+    const cisv_config *config;
+    cisv_result_t **results;
+    bool *ended_on_row;
+    const uint8_t *skip_before;  // Chunks starting before this are not parsed
+} PoolParseJob;
+
+static void pool_parse_task(void *ctx, int index) {
+    PoolParseJob *job = (PoolParseJob *)ctx;
+    const cisv_chunk_t *chunk = &job->chunks[index];
+    if (chunk->start < job->skip_before) return;
+
+    ParallelParseArg arg = {
+        .chunk = chunk,
+        .config = job->config,
+        .result = NULL,
+        .chunk_size_hint = (size_t)(chunk->end - chunk->start),
+    };
+    parallel_parse_thread(&arg);
+    job->results[index] = arg.result;
+    job->ended_on_row[index] = arg.ended_on_row;
+}
 
-    r->rows = new_rows;
-    r->row_capacity = new_cap;
+// One speculative split of the file: chunk boundaries derived from a quote
+// state assumption, parsed lazily
+typedef struct {
+    cisv_chunk_t *chunks;
+    int count;
+    cisv_result_t **results;
+    bool *ended_on_row;
+    bool parsed;
+} SpecSplit;
+
+static void spec_split_free(SpecSplit *split) {
+    if (split->results) {
+        for (int i = 0; i < split->count; i++) {
+            cisv_result_free(split->results[i]);
+        }
+    }
+    free(split->results);
+    free(split->ended_on_row);
+    free(split->chunks);
+}
+
+static bool spec_split_init(SpecSplit *split, const cisv_mmap_file_t *file, size_t range_size,
+                            int range_count, const chunk_scan_t *scans, int initial_state) {
+    memset(split, 0, sizeof(*split));
+    split->chunks = calloc(range_count, sizeof(cisv_chunk_t));
+    split->results = calloc(range_count, sizeof(cisv_result_t *));
+    split->ended_on_row = calloc(range_count, sizeof(bool));
+    if (!split->chunks || !split->results || !split->ended_on_row) {
+        spec_split_free(split);
+        return false;
+    }
+    split->count = chunks_from_scans(file, range_size, range_count, scans, initial_state,
+                                     split->chunks);
     return true;
 }
 
-// Ensure result has capacity for more fields
-static inline bool batch_ensure_fields(cisv_result_t *r, size_t needed) {
-    if (r->total_fields + needed <= r->fields_capacity) return true;
+static void spec_split_parse(cisv_pool_t *pool, SpecSplit *split, const cisv_config *config,
+                             const uint8_t *skip_before) {
+    PoolParseJob job = {
+        .chunks = split->chunks,
+        .config = config,
+        .results = split->results,
+        .ended_on_row = split->ended_on_row,
+        .skip_before = skip_before,
+    };
+    pool_run_job(pool, pool_parse_task, &job, split->count);
+    split->parsed = true;
+}
 
-    // 1.5x growth: reduces memory waste from ~50% to ~33%
-    size_t required = r->total_fields + needed;
-    size_t new_cap = r->fields_capacity + (r->fields_capacity >> 1);
-    if (new_cap < required) new_cap = required;
+// Index of the chunk starting exactly at pos, or -1
+static int spec_split_find(const SpecSplit *split, const uint8_t *pos) {
+    int lo = 0, hi = split->count - 1;
+    while (lo <= hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (split->chunks[mid].start == pos) return mid;
+        if (split->chunks[mid].start < pos) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return -1;
+}
 
-    char **new_fields = realloc(r->all_fields, new_cap * sizeof(char*));
-    if (!new_fields) return false;
+// Take a verified result out of a split (ownership moves to the caller)
+static cisv_result_t *spec_split_take(SpecSplit *split, int index, const uint8_t *file_end,
+                                      const uint8_t **next) {
+    if (index < 0 || !split->results[index]) return NULL;
+    const cisv_chunk_t *chunk = &split->chunks[index];
+    if (!split->ended_on_row[index] && chunk->end != file_end) return NULL;
 
-    size_t *new_lengths = realloc(r->all_lengths, new_cap * sizeof(size_t));
-    if (!new_lengths) {
-        // Preserve the successful realloc result so ownership is not lost
-        // if the second growth step fails.
-        r->all_fields = new_fields;
-        return false;
-    }
+    cisv_result_t *result = split->results[index];
+    split->results[index] = NULL;
+    *next = chunk->end;
+    return result;
+}
 
-    r->all_fields = new_fields;
-    r->all_lengths = new_lengths;
-    r->fields_capacity = new_cap;
-    return true;
+// First chunk start at or after pos in either split, or NULL
+static const uint8_t *spec_next_boundary(const SpecSplit *splits, int split_count,
+                                         const uint8_t *pos) {
+    const uint8_t *best = NULL;
+    for (int s = 0; s < split_count; s++) {
+        int lo = 0, hi = splits[s].count;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (splits[s].chunks[mid].start < pos) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo < splits[s].count && (!best || splits[s].chunks[lo].start < best)) {
+            best = splits[s].chunks[lo].start;
+        }
+    }
+    return best;
 }
 
-// Ensure result has capacity for more field data
-// NOTE: all_fields[] stores offsets (not pointers) during parsing to avoid
-// O(n) pointer fixup on reallocation. Offsets are converted to pointers
-// in batch_result_finalize() after parsing completes.
-static inline bool batch_ensure_data(cisv_result_t *r, size_t needed) {
-    if (r->field_data_size + needed <= r->field_data_capacity) return true;
+// Parse from a known row start to a candidate boundary the parser confirms
+// as a row end (or to EOF). Candidates are speculative boundaries, then
+// newlines past the last of them. Every refuted attempt at least doubles the
+// span of the next one, so the bytes re-parsed from start stay within a
+// small multiple of the span finally accepted: a repair across k refuted
+// boundaries costs O(k) morsels, not O(k^2).
+static cisv_result_t *spec_repair(const cisv_mmap_file_t *file, const cisv_config *config,
+                                  const SpecSplit *splits, int split_count,
+                                  const uint8_t *start, size_t step, const uint8_t **next) {
+    const uint8_t *file_end = file->data + file->size;
+    size_t min_span = 1;
+
+    for (;;) {
+        const uint8_t *end = file_end;
+        if (min_span < (size_t)(file_end - start)) {
+            const uint8_t *b = spec_next_boundary(splits, split_count, start + min_span);
+            if (b) {
+                end = b;
+            } else {
+                size_t skip = min_span > step ? min_span : step;
+                if (skip < (size_t)(file_end - start)) {
+                    const uint8_t *nl = memchr(start + skip - 1, '\n',
+                                               (size_t)(file_end - start) - skip + 1);
+                    if (nl) end = nl + 1;
+                }
+            }
+        }
 
-    // 1.5x growth: reduces memory waste from ~50% to ~33%
-    size_t required = r->field_data_size + needed;
-    size_t new_cap = r->field_data_capacity + (r->field_data_capacity >> 1);
-    if (new_cap < required) new_cap = required;
+        cisv_chunk_t chunk = { .start = start, .end = end };
+        ParallelParseArg arg = {
+            .chunk = &chunk,
+            .config = config,
+            .result = NULL,
+            .chunk_size_hint = (size_t)(end - start),
+        };
+        parallel_parse_thread(&arg);
+        if (!arg.result) return NULL;
+        if (arg.ended_on_row || end == file_end) {
+            *next = end;
+            return arg.result;
+        }
+        cisv_result_free(arg.result);
+        min_span = (size_t)(end - start) * 2;
+    }
+}
 
-    // Round up to 64-byte alignment for cache efficiency
-    new_cap = (new_cap + 63) & ~(size_t)63;
+// Verified results in file order
+typedef struct {
+    cisv_result_t **items;
+    int count;
+    int capacity;
+} SpecResults;
+
+static bool spec_results_push(SpecResults *list, cisv_result_t *result) {
+    if (list->count == list->capacity) {
+        int new_cap = list->capacity ? list->capacity * 2 : 16;
+        cisv_result_t **items = realloc(list->items, new_cap * sizeof(cisv_result_t *));
+        if (!items) return false;
+        list->items = items;
+        list->capacity = new_cap;
+    }
+    list->items[list->count++] = result;
+    return true;
+}
 
-    char *new_data = realloc(r->field_data, new_cap);
-    if (!new_data) return false;
+// Walk the verified chain from *pos until it reaches stop (at least one step
+// is always taken). Each step accepts the predicted morsel starting at *pos,
+// else the alternate one (parsed in parallel the first time it is needed),
+// else re-parses from *pos. Returns false on allocation failure.
+static bool spec_chain(cisv_pool_t *pool, const cisv_mmap_file_t *file,
+                       const cisv_config *config, SpecSplit splits[2], const uint8_t *stop,
+                       size_t step, SpecResults *out, const uint8_t **pos) {
+    const uint8_t *file_end = file->data + file->size;
+
+    do {
+        const uint8_t *next = NULL;
+        cisv_result_t *result = spec_split_take(&splits[0], spec_split_find(&splits[0], *pos),
+                                                file_end, &next);
+        if (!result) {
+            if (!splits[1].parsed) {
+                spec_split_parse(pool, &splits[1], config, *pos);
+            }
+            result = spec_split_take(&splits[1], spec_split_find(&splits[1], *pos),
+                                     file_end, &next);
+        }
+        if (!result) {
+            result = spec_repair(file, config, splits, 2, *pos, step, &next);
+        }
+        if (!result) return false;
+        if (!spec_results_push(out, result)) {
+            cisv_result_free(result);
+            return false;
+        }
+        *pos = next;
+    } while (*pos < stop);
 
-    // No pointer fixup needed - we store offsets, not pointers
-    r->field_data = new_data;
-    r->field_data_capacity = new_cap;
     return true;
 }
 
-// Batch field callback - accumulates fields into result
-// NOTE: stores field offset (not pointer) to avoid O(n) fixup on realloc
-static void batch_field_cb(void *user, const char *data, size_t len) {
-    BatchCollector *bc = (BatchCollector *)user;
-    cisv_result_t *r = bc->result;
+// Scan data[0..size) on the pool and derive both speculative splits
+static bool spec_splits_build(cisv_pool_t *pool, const cisv_mmap_file_t *view,
+                              size_t morsel_size, char quote_char, SpecSplit splits[2]) {
+    size_t ranges = (view->size + morsel_size - 1) / morsel_size;
+    if (ranges > INT_MAX) {
+        errno = EFBIG;
+        return false;
+    }
 
-    // Ensure we have space
-    if (!batch_ensure_fields(r, 1)) {
-        r->error_code = -1;
-        snprintf(r->error_message, sizeof(r->error_message), "Out of memory (fields)");
-        return;
+    chunk_scan_t *scans = malloc(ranges * sizeof(chunk_scan_t));
+    if (!scans) {
+        errno = ENOMEM;
+        return false;
     }
 
-    if (!batch_ensure_data(r, len + 1)) {
-        r->error_code = -1;
-        snprintf(r->error_message, sizeof(r->error_message), "Out of memory (data)");
-        return;
+    PoolScanJob scan_job = {
+        .data = view->data,
+        .size = view->size,
+        .range_size = morsel_size,
+        .range_count = (int)ranges,
+        .quote = (uint8_t)quote_char,
+        .scans = scans,
+    };
+    pool_run_job(pool, pool_scan_task, &scan_job, (int)ranges);
+
+    // splits[0]: parity-predicted boundaries, splits[1]: alternate
+    bool ok = spec_split_init(&splits[0], view, morsel_size, (int)ranges, scans, 0);
+    if (ok && !spec_split_init(&splits[1], view, morsel_size, (int)ranges, scans, 1)) {
+        spec_split_free(&splits[0]);
+        ok = false;
     }
+    free(scans);
+    if (!ok) errno = ENOMEM;
+    return ok;
+}
 
-    // Store current offset before copying (field_data may reallocate)
-    size_t offset = r->field_data_size;
+// Speculative morsel parse. Boundaries placed by the quote-parity scan are
+// only assumptions: a morsel's parse is accepted when it starts where the
+// previous accepted parse ended and the parser itself finished on a row
+// boundary. A refuted assumption switches to the alternate split (every
+// range start flipped, parsed in parallel on demand); anything still
+// unmatched is re-parsed from the last verified row start. Results therefore
+// match a serial parse whatever quoting rules the compiled parse loop uses.
+static cisv_result_t **pool_parse_speculative(cisv_pool_t *pool, const cisv_mmap_file_t *file,
+                                              const cisv_config *config, size_t morsel_size,
+                                              char quote_char, int *result_count) {
+    SpecSplit splits[2];
+    if (!spec_splits_build(pool, file, morsel_size, quote_char, splits)) {
+        return NULL;
+    }
 
-    // Copy field data (null-terminated for convenience)
-    char *dest = r->field_data + offset;
-    memcpy(dest, data, len);
-    dest[len] = '\0';
+    spec_split_parse(pool, &splits[0], config, file->data);
 
-    // Record field offset (converted to pointer in batch_result_finalize)
-    r->all_fields[r->total_fields] = (char*)(uintptr_t)offset;
-    r->all_lengths[r->total_fields] = len;
-    r->total_fields++;
-    r->field_data_size += len + 1;
-}
+    SpecResults out = {0};
+    const uint8_t *pos = file->data;
+    bool ok = spec_chain(pool, file, config, splits, file->data + file->size, morsel_size,
+                         &out, &pos);
 
-// Batch row callback - stores field start index (pointers set up at end)
-// We store the start index in the fields pointer and convert to actual
-// pointers after parsing is complete (to handle reallocation during parsing)
-static void batch_row_cb(void *user) {
-    BatchCollector *bc = (BatchCollector *)user;
-    cisv_result_t *r = bc->result;
+    spec_split_free(&splits[0]);
+    spec_split_free(&splits[1]);
 
-    if (!batch_ensure_rows(r, 1)) {
-        r->error_code = -1;
-        snprintf(r->error_message, sizeof(r->error_message), "Out of memory (rows)");
-        return;
+    if (!ok) {
+        cisv_results_free(out.items, out.count);
+        errno = ENOMEM;
+        return NULL;
     }
 
-    // Store field count and start index (not actual pointers - those are set later)
-    size_t field_count = r->total_fields - bc->current_row_start;
-    cisv_row_t *row = &r->rows[r->row_count];
+    *result_count = out.count;
+    return out.items;
+}
 
-    // Store start index as intptr_t (will be converted to pointer later)
-    row->fields = (char **)(intptr_t)bc->current_row_start;
-    row->field_lengths = NULL;  // Will be set during finalization
-    row->field_count = field_count;
+// Auto morsel size: a few morsels per worker, bounded so huge files
+// still balance and small files are not shredded
+static size_t pool_morsel_size(const cisv_pool_t *pool, size_t file_size, size_t morsel_size) {
+    if (morsel_size == 0) {
+        morsel_size = file_size / ((size_t)pool_parallelism(pool) * POOL_MORSELS_PER_THREAD);
+        if (morsel_size < POOL_MORSEL_MIN) morsel_size = POOL_MORSEL_MIN;
+        if (morsel_size > POOL_MORSEL_MAX) morsel_size = POOL_MORSEL_MAX;
+    }
+    if (morsel_size < 4096) morsel_size = 4096;
+    return morsel_size;
+}
 
-    r->row_count++;
-    bc->current_row_start = r->total_fields;
+static char pool_quote_char(const cisv_config *config) {
+    if (config && config->quote != '\0') {
+        return config->quote;
+    }
+    return '"';
 }
 
-// Finalize result by converting stored indices/offsets to actual pointers
-// Must be called after all parsing is complete
-static void batch_result_finalize(cisv_result_t *r) {
-    // First, convert all field offsets to actual pointers
-    // This is O(n) but only done once at the end, not on every realloc
-    for (size_t i = 0; i < r->total_fields; i++) {
-        size_t offset = (size_t)(uintptr_t)r->all_fields[i];
-        r->all_fields[i] = r->field_data + offset;
+cisv_result_t **cisv_pool_parse_file(cisv_pool_t *pool, const char *path,
+                                     const cisv_config *config, size_t morsel_size,
+                                     int *result_count) {
+    if (!pool || !path || !result_count) {
+        errno = EINVAL;
+        return NULL;
     }
 
-    // Now convert row field indices to actual pointers
-    for (size_t i = 0; i < r->row_count; i++) {
-        size_t start_index = (size_t)(intptr_t)r->rows[i].fields;
-        r->rows[i].fields = &r->all_fields[start_index];
-        r->rows[i].field_lengths = &r->all_lengths[start_index];
+    *result_count = 0;
+
+    cisv_mmap_file_t *mmap_file = cisv_mmap_open(path);
+    if (!mmap_file) {
+        return NULL;
     }
+
+    morsel_size = pool_morsel_size(pool, mmap_file->size, morsel_size);
+    cisv_result_t **results = pool_parse_speculative(pool, mmap_file, config, morsel_size,
+                                                     pool_quote_char(config), result_count);
+    cisv_mmap_close(mmap_file);
+    return results;
 }
 
-// Batch error callback
-static void batch_error_cb(void *user, int line, const char *msg) {
-    BatchCollector *bc = (BatchCollector *)user;
-    cisv_result_t *r = bc->result;
+// One window of an ordered stream: [start, start + size) is split and its
+// predicted morsels are parsed in the background while the previous window
+// is delivered. The morsel cut by the window end is left for the next window.
+typedef struct {
+    cisv_mmap_file_t view;
+    SpecSplit splits[2];
+    const uint8_t *stop;         // Chain stops once it reaches this position
+    PoolParseJob parse;
+    cisv_pool_job job;
+} StreamWindow;
+
+static bool stream_window_start(cisv_pool_t *pool, StreamWindow *w,
+                                const cisv_mmap_file_t *file, const cisv_config *config,
+                                const uint8_t *start, size_t window_bytes, size_t morsel_size) {
+    const uint8_t *file_end = file->data + file->size;
+    size_t size = (size_t)(file_end - start);
+    if (size > window_bytes) size = window_bytes;
+
+    w->view.data = (uint8_t *)start;
+    w->view.size = size;
+    w->view.fd = -1;
+    if (!spec_splits_build(pool, &w->view, morsel_size, pool_quote_char(config), w->splits)) {
+        return false;
+    }
 
-    if (r->error_code == 0) {
-        r->error_code = -1;
-        snprintf(r->error_message, sizeof(r->error_message),
-                 "Parse error at line %d: %s", line, msg ? msg : "unknown error");
+    w->stop = file_end;
+    if (start + size < file_end) {
+        for (int s = 0; s < 2; s++) {
+            w->splits[s].count--;
+        }
+        w->stop = w->splits[0].chunks[w->splits[0].count].start;
     }
-}
 
-// Maximum initial allocation for pre-sized buffers (500MB)
-#define BATCH_MAX_INITIAL_ALLOC (500 * 1024 * 1024)
+    w->parse = (PoolParseJob){
+        .chunks = w->splits[0].chunks,
+        .config = config,
+        .results = w->splits[0].results,
+        .ended_on_row = w->splits[0].ended_on_row,
+        .skip_before = start,
+    };
+    pool_job_submit(pool, &w->job, pool_parse_task, &w->parse, w->splits[0].count);
+    w->splits[0].parsed = true;
+    return true;
+}
 
-// Allocate and initialize a new result structure with size hints
-// file_size_hint: estimated file size (0 to use defaults)
-static cisv_result_t *batch_result_create_with_hint(size_t file_size_hint) {
-    cisv_result_t *r = calloc(1, sizeof(cisv_result_t));
-    if (!r) return NULL;
+// Hand one verified morsel to the consumer. Returns non-zero to stop.
+static int stream_deliver(const cisv_result_t *result, const cisv_config *config,
+                          cisv_batch_cb batch_cb) {
+    void *user = config ? config->user : NULL;
 
-    // Estimate buffer sizes based on file size
-    // Heuristics: ~100 bytes/row average, ~8 fields/row average
-    size_t row_cap = BATCH_INITIAL_ROWS;
-    size_t field_cap = BATCH_INITIAL_FIELDS;
-    size_t data_cap = BATCH_INITIAL_DATA;
+    if (result->error_code != 0 && config && config->error_cb) {
+        config->error_cb(user, 0, result->error_message);
+    }
+    if (batch_cb) {
+        return batch_cb(user, result);
+    }
 
-    if (file_size_hint > 0) {
-        // Estimate rows: assume ~100 bytes per row on average
-        size_t est_rows = file_size_hint / 100;
-        if (est_rows > row_cap && est_rows * sizeof(cisv_row_t) < BATCH_MAX_INITIAL_ALLOC) {
-            row_cap = est_rows;
+    for (size_t r = 0; r < result->row_count; r++) {
+        const cisv_row_t *row = &result->rows[r];
+        if (config->field_cb) {
+            for (size_t i = 0; i < row->field_count; i++) {
+                config->field_cb(user, row->fields[i], row->field_lengths[i]);
+            }
         }
+        if (config->row_cb) config->row_cb(user);
+    }
+    return 0;
+}
 
-        // Estimate fields: assume ~8 fields per row
-        size_t est_fields = est_rows * 8;
-        if (est_fields > field_cap && est_fields * sizeof(char*) < BATCH_MAX_INITIAL_ALLOC) {
-            field_cap = est_fields;
+// Ordered streaming parse. Window k+1 is scanned and parsed on the workers
+// while window k is delivered on the calling thread, so at most two windows
+// of results exist at once. Mapped pages behind the delivery point are
+// dropped as the stream moves on.
+int cisv_pool_stream_file(cisv_pool_t *pool, const char *path, const cisv_config *config,
+                          size_t morsel_size, int window, cisv_batch_cb batch_cb) {
+    if (!pool || !path || (!batch_cb && !config)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return -1;
+    }
+    if (st.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+
+    // No MAP_POPULATE: only the windows in flight should become resident
+    cisv_mmap_file_t file = { .size = (size_t)st.st_size, .fd = fd };
+    file.data = mmap(NULL, file.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (file.data == MAP_FAILED) {
+        close(fd);
+        return -1;
+    }
+    madvise(file.data, file.size, MADV_SEQUENTIAL);
+
+    // Small morsels keep the window small; the file size plays no part here
+    if (morsel_size == 0) morsel_size = POOL_MORSEL_MIN;
+    morsel_size = pool_morsel_size(pool, file.size, morsel_size);
+    if (window <= 0) window = pool_parallelism(pool) * 2;
+    size_t window_bytes = morsel_size * (size_t)window;
+
+    const uint8_t *file_end = file.data + file.size;
+    const uint8_t *pos = file.data;
+    const uint8_t *released = file.data;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    SpecResults ready = {0};
+    int rc = 0;
+    bool stopped = false;
+
+    while (rc == 0 && (pos < file_end || ready.count > 0)) {
+        StreamWindow w;
+        bool have_window = pos < file_end && !stopped;
+        if (have_window && !stream_window_start(pool, &w, &file, config, pos,
+                                                window_bytes, morsel_size)) {
+            rc = -1;
+            break;
         }
 
-        // Field data needs at least file_size bytes (strings + null terminators)
-        // Add 10% overhead for null terminators
-        size_t est_data = file_size_hint + (file_size_hint / 10);
-        if (est_data > data_cap && est_data < BATCH_MAX_INITIAL_ALLOC) {
-            data_cap = est_data;
+        for (int i = 0; i < ready.count; i++) {
+            if (!stopped && stream_deliver(ready.items[i], config, batch_cb) != 0) {
+                stopped = true;
+            }
+            cisv_result_free(ready.items[i]);
         }
+        ready.count = 0;
 
-        // Align data capacity to 64 bytes for cache efficiency
-        data_cap = (data_cap + 63) & ~(size_t)63;
-    }
+        if (!have_window) break;
+        pool_job_wait(&w.job);
 
-    // Allocate buffers with estimated sizes
-    r->rows = malloc(row_cap * sizeof(cisv_row_t));
-    r->all_fields = malloc(field_cap * sizeof(char*));
-    r->all_lengths = malloc(field_cap * sizeof(size_t));
-    r->field_data = malloc(data_cap);
+        // The previous window is fully delivered and this one is parsed
+        const uint8_t *drop = file.data + ((size_t)(pos - file.data) / page) * page;
+        if (drop > released) {
+            madvise((void *)released, (size_t)(drop - released), MADV_DONTNEED);
+            released = drop;
+        }
 
-    if (!r->rows || !r->all_fields || !r->all_lengths || !r->field_data) {
-        free(r->rows);
-        free(r->all_fields);
-        free(r->all_lengths);
-        free(r->field_data);
-        free(r);
-        return NULL;
+        if (!stopped && !spec_chain(pool, &file, config, w.splits, w.stop, morsel_size,
+                                    &ready, &pos)) {
+            errno = ENOMEM;
+            rc = -1;
+        }
+        spec_split_free(&w.splits[0]);
+        spec_split_free(&w.splits[1]);
+        if (stopped) pos = file_end;
     }
 
-    r->row_capacity = row_cap;
-    r->fields_capacity = field_cap;
-    r->field_data_capacity = data_cap;
+    cisv_results_free(ready.items, ready.count);
+    munmap(file.data, file.size);
+    close(fd);
+    return rc;
+}
 
-    return r;
+// Shared pool for cisv_parse_file_parallel, sized to the largest thread
+// count asked for so far. Each call caps its jobs at its own count through
+// pool_width. A larger request replaces the pool; the outgrown one is
+// destroyed by the last call still running on it.
+typedef struct {
+    cisv_pool_t *pool;
+    int users;                   // Calls running on the pool (shared_pool_lock)
+} SharedPool;
+
+static pthread_mutex_t shared_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static SharedPool *shared_pool;
+static pthread_once_t shared_pool_once = PTHREAD_ONCE_INIT;
+
+// Worker threads do not survive fork(): a child starts without a shared pool
+static void shared_pool_atfork_child(void) {
+    pthread_mutex_init(&shared_pool_lock, NULL);
+    shared_pool = NULL;
 }
 
-// Allocate and initialize a new result structure with default sizes
-static cisv_result_t *batch_result_create(void) {
-    return batch_result_create_with_hint(0);
+static void shared_pool_init(void) {
+    pthread_atfork(NULL, NULL, shared_pool_atfork_child);
 }
 
-void cisv_result_free(cisv_result_t *result) {
-    if (!result) return;
+static SharedPool *shared_pool_acquire(int num_threads) {
+    pthread_once(&shared_pool_once, shared_pool_init);
+
+    SharedPool *retired = NULL;
+    pthread_mutex_lock(&shared_pool_lock);
+    SharedPool *sp = shared_pool;
+    if (!sp || sp->pool->num_threads < num_threads) {
+        SharedPool *grown = malloc(sizeof(SharedPool));
+        cisv_pool_t *pool = grown ? cisv_pool_create(num_threads) : NULL;
+        if (!pool) {
+            free(grown);
+            pthread_mutex_unlock(&shared_pool_lock);
+            if (!grown) errno = ENOMEM;
+            return NULL;
+        }
+        grown->pool = pool;
+        grown->users = 0;
+        if (sp && sp->users == 0) retired = sp;
+        shared_pool = sp = grown;
+    }
+    sp->users++;
+    pthread_mutex_unlock(&shared_pool_lock);
 
-    // Note: row->fields and row->field_lengths point into all_fields/all_lengths
-    // so we don't need to free them separately
-    free(result->rows);
-    free(result->all_fields);
-    free(result->all_lengths);
-    free(result->field_data);
-    free(result);
+    if (retired) {
+        cisv_pool_destroy(retired->pool);
+        free(retired);
+    }
+    return sp;
 }
 
-cisv_result_t *cisv_parse_file_batch(const char *path, const cisv_config *config) {
-    if (!path) {
+static void shared_pool_release(SharedPool *sp) {
+    pthread_mutex_lock(&shared_pool_lock);
+    bool outgrown = --sp->users == 0 && sp != shared_pool;
+    pthread_mutex_unlock(&shared_pool_lock);
+
+    if (outgrown) {
+        cisv_pool_destroy(sp->pool);
+        free(sp);
+    }
+}
+
+cisv_result_t **cisv_parse_file_parallel(const char *path, const cisv_config *config,
+                                          int num_threads, int *result_count) {
+    if (!path || !result_count) {
         errno = EINVAL;
         return NULL;
     }
 
-    // Get file size for buffer pre-sizing (reduces reallocations)
-    size_t file_size_hint = 0;
-    struct stat st;
-    if (stat(path, &st) == 0 && S_ISREG(st.st_mode)) {
-        file_size_hint = (size_t)st.st_size;
+    *result_count = 0;
+
+    // Auto-detect thread count
+    if (num_threads <= 0) {
+        num_threads = get_cpu_count();
     }
 
-    cisv_result_t *result = batch_result_create_with_hint(file_size_hint);
-    if (!result) {
-        errno = ENOMEM;
+    // Limit to reasonable maximum
+    if (num_threads > POOL_MAX_THREADS) num_threads = POOL_MAX_THREADS;
+
+    SharedPool *sp = shared_pool_acquire(num_threads);
+    if (!sp) {
         return NULL;
     }
 
-    BatchCollector bc = {
-        .result = result,
-        .current_row_start = 0
-    };
+    const cisv_pool_t *saved_pool = pool_width_pool;
+    int saved_width = pool_width;
+    pool_width_pool = sp->pool;
+    pool_width = num_threads;
+    cisv_result_t **results = cisv_pool_parse_file(sp->pool, path, config, 0, result_count);
+    pool_width_pool = saved_pool;
+    pool_width = saved_width;
 
-    // Create config with batch callbacks
-    cisv_config batch_config;
-    if (config) {
-        batch_config = *config;
-    } else {
-        cisv_config_init(&batch_config);
+    int saved_errno = errno;
+    shared_pool_release(sp);
+    errno = saved_errno;
+    return results;
+}
+
+int cisv_parse_file_parallel_stream(const char *path, const cisv_config *config,
+                                    int num_threads) {
+    if (num_threads <= 0) {
+        num_threads = get_cpu_count();
     }
-    batch_config.field_cb = batch_field_cb;
-    batch_config.row_cb = batch_row_cb;
-    batch_config.error_cb = batch_error_cb;
-    batch_config.user = &bc;
+    if (num_threads > POOL_MAX_THREADS) num_threads = POOL_MAX_THREADS;
 
-    cisv_parser *parser = cisv_parser_create_with_config(&batch_config);
-    if (!parser) {
-        cisv_result_free(result);
-        errno = ENOMEM;
-        return NULL;
+    SharedPool *sp = shared_pool_acquire(num_threads);
+    if (!sp) {
+        return -1;
     }
 
-    int parse_result = cisv_parser_parse_file(parser, path);
-    cisv_parser_destroy(parser);
+    const cisv_pool_t *saved_pool = pool_width_pool;
+    int saved_width = pool_width;
+    pool_width_pool = sp->pool;
+    pool_width = num_threads;
+    int rc = cisv_pool_stream_file(sp->pool, path, config, 0, 0, NULL);
+    pool_width_pool = saved_pool;
+    pool_width = saved_width;
 
-    if (parse_result < 0) {
-        result->error_code = parse_result;
-        snprintf(result->error_message, sizeof(result->error_message),
-                 "Failed to parse file: %s", strerror(-parse_result));
+    int saved_errno = errno;
+    shared_pool_release(sp);
+    errno = saved_errno;
+    return rc;
+}
+
+void cisv_results_free(cisv_result_t **results, int count) {
+    if (!results) return;
+
+    for (int i = 0; i < count; i++) {
+        cisv_result_free(results[i]);
     }
+    free(results);
+}
 
-    // Convert stored indices to actual pointers now that parsing is complete
-    batch_result_finalize(result);
+// =============================================================================
+// Two-Stage Structural Index Implementation
+// Stage 1 reuses the bitmask classifier to record separator offsets; stage 2
+// computes field spans from neighbouring offsets and only touches the bytes
+// of fields that are emitted
+// =============================================================================
 
-    return result;
+#define INDEX_INITIAL_FIELDS 1024
+#define INDEX_INITIAL_ROWS 256
+
+static bool index_ensure_fields(cisv_index_t *idx, size_t needed) {
+    size_t required = idx->field_count + needed;
+    if (required <= idx->field_capacity) return true;
+
+    size_t new_cap = idx->field_capacity + (idx->field_capacity >> 1);
+    if (new_cap < required) new_cap = required;
+    new_cap = (new_cap + 63) & ~(size_t)63;  // Whole bitmap words
+
+    uint32_t *new_seps = realloc(idx->seps, new_cap * sizeof(uint32_t));
+    if (!new_seps) return false;
+    idx->seps = new_seps;
+
+    size_t old_words = idx->field_capacity / 64;
+    uint64_t *new_quoted = realloc(idx->quoted, (new_cap / 64) * sizeof(uint64_t));
+    if (!new_quoted) return false;
+    memset(new_quoted + old_words, 0, (new_cap / 64 - old_words) * sizeof(uint64_t));
+    idx->quoted = new_quoted;
+
+    idx->field_capacity = new_cap;
+    return true;
 }
 
-cisv_result_t *cisv_parse_string_batch(const char *data, size_t len, const cisv_config *config) {
-    if (!data) {
+static bool index_ensure_rows(cisv_index_t *idx, size_t needed) {
+    // rows[] keeps one trailing sentinel entry
+    size_t required = idx->row_count + needed + 1;
+    if (required <= idx->row_capacity) return true;
+
+    size_t new_cap = idx->row_capacity + (idx->row_capacity >> 1);
+    if (new_cap < required) new_cap = required;
+
+    uint32_t *new_rows = realloc(idx->rows, new_cap * sizeof(uint32_t));
+    if (!new_rows) return false;
+    idx->rows = new_rows;
+    idx->row_capacity = new_cap;
+    return true;
+}
+
+cisv_index_t *cisv_index_build(const uint8_t *data, size_t len, const cisv_config *config) {
+    if (!data && len > 0) {
         errno = EINVAL;
         return NULL;
     }
+    // Offsets are 32-bit and the EOF sentinel uses offset == len
+    if (len >= UINT32_MAX) {
+        errno = EFBIG;
+        return NULL;
+    }
 
-    cisv_result_t *result = batch_result_create();
-    if (!result) {
+    cisv_index_t *idx = calloc(1, sizeof(cisv_index_t));
+    if (!idx) {
         errno = ENOMEM;
         return NULL;
     }
 
-    BatchCollector bc = {
-        .result = result,
-        .current_row_start = 0
-    };
-
-    // Create config with batch callbacks
-    cisv_config batch_config;
-    if (config) {
-        batch_config = *config;
-    } else {
-        cisv_config_init(&batch_config);
-    }
-    batch_config.field_cb = batch_field_cb;
-    batch_config.row_cb = batch_row_cb;
-    batch_config.error_cb = batch_error_cb;
-    batch_config.user = &bc;
+    idx->data = data;
+    idx->size = len;
+    idx->delimiter = config ? config->delimiter : ',';
+    idx->quote = config ? config->quote : '"';
 
-    cisv_parser *parser = cisv_parser_create_with_config(&batch_config);
-    if (!parser) {
-        cisv_result_free(result);
+    // Heuristic pre-size: ~1 separator per 8 bytes, ~1 row per 64 bytes
+    if (!index_ensure_fields(idx, len / 8 + INDEX_INITIAL_FIELDS) ||
+        !index_ensure_rows(idx, len / 64 + INDEX_INITIAL_ROWS)) {
+        cisv_index_free(idx);
         errno = ENOMEM;
         return NULL;
     }
+    idx->rows[0] = 0;
+
+    const uint8_t delim = (uint8_t)idx->delimiter;
+    const uint8_t quote = (uint8_t)idx->quote;
+    uint64_t quote_carry = 0;    // All ones while a quoted region spans blocks
+    bool pending_quote = false;  // Current field saw a quote in an earlier block
+    size_t field_start = 0;
+
+    for (size_t off = 0; off < len; off += 64) {
+        size_t remaining = len - off;
+        uint64_t valid = ~0ULL;
+        uint8_t tail[64];
+        const uint8_t *block = data + off;
+
+        if (__builtin_expect(remaining < 64, 0)) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, remaining);
+            block = tail;
+            valid = (1ULL << remaining) - 1;
+        } else {
+            __builtin_prefetch(data + off + PREFETCH_DISTANCE, 0, 1);
+        }
 
-    cisv_parser_write(parser, (const uint8_t *)data, len);
-    cisv_parser_end(parser);
-    cisv_parser_destroy(parser);
+        // Each block adds at most 64 fields and 64 rows
+        if (!index_ensure_fields(idx, 64) || !index_ensure_rows(idx, 64)) {
+            cisv_index_free(idx);
+            errno = ENOMEM;
+            return NULL;
+        }
 
-    // Convert stored indices to actual pointers now that parsing is complete
-    batch_result_finalize(result);
+        uint64_t quote_bits, delim_bits, nl_bits;
+        bitmask_classify_block(block, delim, quote, &quote_bits, &delim_bits, &nl_bits);
+        quote_bits &= valid;
 
-    return result;
-}
+        uint64_t in_quote = bitmask_prefix_xor(quote_bits) ^ quote_carry;
+        quote_carry = (uint64_t)((int64_t)in_quote >> 63);
 
-// =============================================================================
-// Parallel Batch Parsing Implementation
-// =============================================================================
+        uint64_t structural = (delim_bits | nl_bits) & ~in_quote & valid;
+        uint64_t quotes_left = quote_bits;
 
-#include <pthread.h>
+        while (structural) {
+            int pos = __builtin_ctzll(structural);
+            uint64_t below = (1ULL << pos) - 1;
+            size_t fi = idx->field_count;
 
-// Thread argument for parallel parsing
-typedef struct {
-    const cisv_chunk_t *chunk;
-    const cisv_config *config;
-    cisv_result_t *result;
-    size_t chunk_size_hint;
-} ParallelParseArg;
+            if (pending_quote || (quotes_left & below)) {
+                idx->quoted[fi >> 6] |= 1ULL << (fi & 63);
+            }
+            quotes_left &= ~below;
+            pending_quote = false;
 
-// Thread function for parallel parsing
-static void *parallel_parse_thread(void *arg) {
-    ParallelParseArg *parg = (ParallelParseArg *)arg;
+            idx->seps[fi] = (uint32_t)(off + (size_t)pos);
+            idx->field_count++;
 
-    cisv_result_t *result = batch_result_create_with_hint(parg->chunk_size_hint);
-    if (!result) {
-        parg->result = NULL;
-        return NULL;
+            if (nl_bits & (1ULL << pos)) {
+                idx->row_count++;
+                idx->rows[idx->row_count] = (uint32_t)idx->field_count;
+            }
+            field_start = off + (size_t)pos + 1;
+            structural &= structural - 1;
+        }
+
+        if (quotes_left) pending_quote = true;
     }
 
-    BatchCollector bc = {
-        .result = result,
-        .current_row_start = 0
-    };
+    idx->unterminated = (quote_carry != 0);
 
-    // Create config with batch callbacks
-    cisv_config batch_config;
-    if (parg->config) {
-        batch_config = *parg->config;
-    } else {
-        cisv_config_init(&batch_config);
+    // Trailing field without a newline ends at the EOF sentinel
+    if (field_start < len || idx->unterminated) {
+        size_t fi = idx->field_count;
+        if (pending_quote) {
+            idx->quoted[fi >> 6] |= 1ULL << (fi & 63);
+        }
+        idx->seps[fi] = (uint32_t)len;
+        idx->field_count++;
     }
-    batch_config.field_cb = batch_field_cb;
-    batch_config.row_cb = batch_row_cb;
-    batch_config.error_cb = batch_error_cb;
-    batch_config.user = &bc;
-
-    cisv_parser *parser = cisv_parser_create_with_config(&batch_config);
-    if (!parser) {
-        cisv_result_free(result);
-        parg->result = NULL;
-        return NULL;
+    if (idx->field_count > idx->rows[idx->row_count]) {
+        idx->row_count++;
+        idx->rows[idx->row_count] = (uint32_t)idx->field_count;
     }
 
-    cisv_parse_chunk(parser, parg->chunk);
-    cisv_parser_destroy(parser);
+    return idx;
+}
 
-    // Convert stored indices to actual pointers now that parsing is complete
-    batch_result_finalize(result);
+cisv_index_t *cisv_index_build_chunk(const cisv_chunk_t *chunk, const cisv_config *config) {
+    if (!chunk || !chunk->start || chunk->end < chunk->start) {
+        errno = EINVAL;
+        return NULL;
+    }
+    return cisv_index_build(chunk->start, (size_t)(chunk->end - chunk->start), config);
+}
 
-    parg->result = result;
-    return NULL;
+void cisv_index_free(cisv_index_t *index) {
+    if (!index) return;
+    free(index->seps);
+    free(index->quoted);
+    free(index->rows);
+    free(index);
 }
 
-// Get number of available CPUs
-static int get_cpu_count(void) {
-#ifdef _SC_NPROCESSORS_ONLN
-    long count = sysconf(_SC_NPROCESSORS_ONLN);
-    if (count > 0) return (int)count;
-#endif
-    return 4;  // Default fallback
+size_t cisv_index_row_fields(const cisv_index_t *index, size_t row) {
+    if (!index || row >= index->row_count) return 0;
+    return (size_t)(index->rows[row + 1] - index->rows[row]);
 }
 
-cisv_result_t **cisv_parse_file_parallel(const char *path, const cisv_config *config,
-                                          int num_threads, int *result_count) {
-    if (!path || !result_count) {
-        errno = EINVAL;
-        return NULL;
-    }
+// Emit field fi of the index (last_in_row enables CRLF handling)
+static inline void index_yield_field(cisv_parser *p, const cisv_index_t *idx,
+                                     size_t fi, bool last_in_row) {
+    const uint8_t *data = idx->data;
+    size_t start = fi ? (size_t)idx->seps[fi - 1] + 1 : 0;
+    size_t end = idx->seps[fi];
 
-    *result_count = 0;
+    // Row-ending newline: strip the preceding CR (EOF sentinel is never stripped)
+    if (last_in_row && end < idx->size && end > start && data[end - 1] == '\r') {
+        end--;
+    }
 
-    // Auto-detect thread count
-    if (num_threads <= 0) {
-        num_threads = get_cpu_count();
+    if (idx->quoted[fi >> 6] & (1ULL << (fi & 63))) {
+        if (start < end && data[start] == (uint8_t)idx->quote) {
+            bool terminated = !(idx->unterminated && fi + 1 == idx->field_count);
+            yield_quoted_raw(p, data + start, data + end, terminated);
+            return;
+        }
     }
+    yield_field(p, data + start, data + end);
+}
 
-    // Limit to reasonable maximum
-    if (num_threads > 64) num_threads = 64;
+int cisv_parse_index(cisv_parser *p, const cisv_index_t *idx,
+                     const int *columns, size_t column_count) {
+    if (!p || !idx) return -EINVAL;
+    if (p->delimiter != idx->delimiter || p->quote != idx->quote) return -EINVAL;
 
-    // Memory-map the file
-    cisv_mmap_file_t *mmap_file = cisv_mmap_open(path);
-    if (!mmap_file) {
-        return NULL;
-    }
+    // Row controls are evaluated per row here, so skipped leading columns
+    // cannot be mistaken for comment prefixes.
+    bool row_controls = p->has_row_controls;
+    p->has_row_controls = false;
+    p->streaming_mode = false;
 
-    // Split into chunks
-    int chunk_count;
-    char quote_char = '"';
-    if (config && config->quote != '\0') {
-        quote_char = config->quote;
+    // Columns are picked directly from the index, so the per-field mask is
+    // bypassed; without an explicit list the configured projection is used.
+    uint64_t *select_mask = p->select_mask;
+    p->select_mask = NULL;
+    if (!columns && p->select_list) {
+        columns = p->select_list;
+        column_count = p->select_list_count;
     }
-    cisv_chunk_t *chunks = split_chunks_with_quote(mmap_file, num_threads, &chunk_count, quote_char);
-    if (!chunks || chunk_count == 0) {
-        cisv_mmap_close(mmap_file);
-        return NULL;
+    p->state = S_NORMAL;
+    p->quote_buffer_pos = 0;
+    p->current_row_fields = 0;
+    p->current_row_size = 0;
+    p->current_col = 0;
+    p->skip_current_row = false;
+    p->row_is_comment = false;
+
+    if (idx->unterminated && p->ecb) {
+        p->ecb(p->user, p->line_num + (int)idx->row_count, "Unterminated quoted field at EOF");
     }
 
-    // Fast path: single chunk does not benefit from thread orchestration.
-    if (chunk_count == 1) {
-        cisv_result_t **results = calloc(1, sizeof(cisv_result_t *));
-        if (!results) {
-            free(chunks);
-            cisv_mmap_close(mmap_file);
-            errno = ENOMEM;
-            return NULL;
-        }
+    for (size_t r = 0; r < idx->row_count; r++) {
+        size_t first = idx->rows[r];
+        size_t last = idx->rows[r + 1];
+        size_t nfields = last - first;
 
-        ParallelParseArg arg = {
-            .chunk = &chunks[0],
-            .config = config,
-            .result = NULL,
-            .chunk_size_hint = (size_t)(chunks[0].end - chunks[0].start),
-        };
+        if (__builtin_expect(row_controls, 0)) {
+            size_t row_start = first ? (size_t)idx->seps[first - 1] + 1 : 0;
+            size_t row_end = idx->seps[last - 1];
 
-        parallel_parse_thread(&arg);
-        results[0] = arg.result;
+            if (p->comment && row_start < row_end &&
+                idx->data[row_start] == (uint8_t)p->comment) {
+                p->row_is_comment = true;
+            } else if (p->max_row_size > 0 && row_end - row_start + 1 > p->max_row_size) {
+                if (p->ecb) {
+                    p->ecb(p->user, p->line_num + 1, "Row exceeds max_row_size");
+                }
+                if (p->skip_lines_with_error) {
+                    p->skip_current_row = true;
+                }
+            }
+            if (p->row_is_comment || p->skip_current_row) {
+                yield_row(p);
+                continue;
+            }
+        }
 
-        free(chunks);
-        cisv_mmap_close(mmap_file);
-        *result_count = 1;
-        return results;
+        if (columns) {
+            for (size_t c = 0; c < column_count; c++) {
+                int col = columns[c];
+                if (col < 0 || (size_t)col >= nfields) continue;
+                index_yield_field(p, idx, first + (size_t)col, (size_t)col + 1 == nfields);
+            }
+        } else {
+            for (size_t fi = first; fi < last; fi++) {
+                index_yield_field(p, idx, fi, fi + 1 == last);
+            }
+        }
+        yield_row(p);
     }
 
-    // Allocate thread arguments and results array
-    ParallelParseArg *args = calloc(chunk_count, sizeof(ParallelParseArg));
-    pthread_t *threads = calloc(chunk_count, sizeof(pthread_t));
-    cisv_result_t **results = calloc(chunk_count, sizeof(cisv_result_t *));
+    p->has_row_controls = row_controls;
+    p->select_mask = select_mask;
+    return 0;
+}
+
+cisv_result_t *cisv_parse_index_batch(const cisv_index_t *index, const cisv_config *config,
+                                      const int *columns, size_t column_count) {
+    if (!index) {
+        errno = EINVAL;
+        return NULL;
+    }
 
-    if (!args || !threads || !results) {
-        free(args);
-        free(threads);
-        free(results);
-        free(chunks);
-        cisv_mmap_close(mmap_file);
+    cisv_result_t *result = batch_result_create_with_hint(index->size);
+    if (!result) {
         errno = ENOMEM;
         return NULL;
     }
 
-    // Launch threads
-    for (int i = 0; i < chunk_count; i++) {
-        args[i].chunk = &chunks[i];
-        args[i].config = config;
-        args[i].result = NULL;
-        args[i].chunk_size_hint = (size_t)(chunks[i].end - chunks[i].start);
+    BatchCollector bc = {
+        .result = result,
+        .current_row_start = 0
+    };
 
-        if (pthread_create(&threads[i], NULL, parallel_parse_thread, &args[i]) != 0) {
-            // Thread creation failed - wait for already-launched threads
-            for (int j = 0; j < i; j++) {
-                pthread_join(threads[j], NULL);
-                if (args[j].result) {
-                    cisv_result_free(args[j].result);
-                }
-            }
-            free(args);
-            free(threads);
-            free(results);
-            free(chunks);
-            cisv_mmap_close(mmap_file);
-            return NULL;
-        }
+    // Create config with batch callbacks
+    cisv_config batch_config;
+    if (config) {
+        batch_config = *config;
+    } else {
+        cisv_config_init(&batch_config);
+        batch_config.delimiter = index->delimiter;
+        batch_config.quote = index->quote;
     }
+    batch_config.field_cb = batch_field_cb;
+    batch_config.row_cb = batch_row_cb;
+    batch_config.error_cb = batch_error_cb;
+    batch_config.user = &bc;
+    batch_config.release_cb = NULL;
 
-    // Wait for all threads to complete
-    for (int i = 0; i < chunk_count; i++) {
-        pthread_join(threads[i], NULL);
-        results[i] = args[i].result;
+    cisv_parser *parser = cisv_parser_create_with_config(&batch_config);
+    if (!parser) {
+        cisv_result_free(result);
+        errno = ENOMEM;
+        return NULL;
     }
 
-    free(args);
-    free(threads);
-    free(chunks);
-    cisv_mmap_close(mmap_file);
+    int rc = cisv_parse_index(parser, index, columns, column_count);
+    cisv_parser_destroy(parser);
 
-    *result_count = chunk_count;
-    return results;
-}
+    if (rc < 0) {
+        result->error_code = rc;
+        snprintf(result->error_message, sizeof(result->error_message),
+                 "Index does not match parser configuration");
+    }
 
-void cisv_results_free(cisv_result_t **results, int count) {
-    if (!results) return;
+    // Convert stored indices to actual pointers now that parsing is complete
+    batch_result_finalize(result);
 
-    for (int i = 0; i < count; i++) {
-        cisv_result_free(results[i]);
-    }
-    free(results);
+    return result;
 }
 
 // =============================================================================
@@ -2647,40 +7194,62 @@ void cisv_results_free(cisv_result_t **results, int count) {
 
 // Initial allocation sizes for iterator
 #define ITER_INITIAL_FIELDS 32
-#define ITER_INITIAL_DATA 4096
+#define ITER_INITIAL_ROWS 64
+#define ITER_DEFAULT_BATCH 1024
 
 struct cisv_iterator {
-    // File access (mmap)
+    // File access (read-only mmap)
     int fd;
-    uint8_t *data;
+    uint8_t *data;             // Current mapping window
     size_t file_size;
+    size_t map_offset;         // File offset of data[0]
+    size_t map_len;            // Bytes mapped at data
+    size_t window;             // Window size (file_size = whole file)
+    bool map_last;             // Window reaches the end of the file
+    bool remap_pending;        // Next row starts past the window (batch ended early)
 
     // Position tracking
     const uint8_t *pos;        // Current position
-    const uint8_t *end;        // End of file
+    const uint8_t *end;        // End of the mapped window
+
+    // Bitmasks of the 64-byte block at block_base, classified once and
+    // reused by every field that starts inside it
+    const uint8_t *block_base;
+    uint64_t quote_bits;
+    uint64_t sep_bits;         // Delimiter | newline
 
-    // Row buffer (reused, grows as needed)
+    // Row buffer (reused, grows as needed). Fields are spans into data,
+    // except quoted fields with "" pairs, which are unescaped into scratch.
     char **fields;             // Pointers to field data
     size_t *lengths;           // Field lengths
-    size_t field_count;        // Fields in current row
+    size_t field_count;        // Fields in current row (or batch)
     size_t field_capacity;     // Allocated slots
 
-    // Field data storage (contiguous)
-    char *field_data;          // String storage
-    size_t field_data_len;     // Current usage
-    size_t field_data_cap;     // Capacity
-
-    // Parser state
-    int state;                 // S_NORMAL, S_QUOTED
+    // Unescaped fields of the current row (or batch). Their fields[] slots
+    // hold scratch offsets until the row is handed out, since scratch may
+    // move while it grows.
+    uint8_t *scratch;
+    size_t scratch_len;
+    size_t scratch_cap;
+    size_t *scratch_fields;    // Indexes into fields[], ascending
+    size_t scratch_count;
+    size_t scratch_fields_cap;
+
+    // Row starts of the current batch (cisv_iterator_next_batch)
+    size_t *row_offsets;
+    size_t row_capacity;
+
+    // Parser config
     char delimiter;
     char quote;
     bool trim;
     bool skip_empty_lines;
 
-    // Quote buffer for escaped quotes
-    uint8_t *quote_buffer;
-    size_t quote_buffer_pos;
-    size_t quote_buffer_size;
+    // Column projection (NULL = all columns)
+    uint64_t *select_mask;
+    size_t select_mask_cols;
+    size_t current_col;        // Input column of the next field in the row
+    size_t first_len;          // Length of input column 0 (empty-row detection)
 
     // Status
     bool eof;
@@ -2710,71 +7279,132 @@ static inline bool iter_ensure_fields(cisv_iterator_t *it, size_t needed) {
     return true;
 }
 
-// Ensure iterator has capacity for more field data
-static inline bool iter_ensure_data(cisv_iterator_t *it, size_t needed) {
-    size_t required = it->field_data_len + needed + 1;  // +1 for null terminator
-    if (required <= it->field_data_cap) return true;
-
-    size_t new_cap = it->field_data_cap + (it->field_data_cap >> 1);
-    if (new_cap < required) new_cap = required;
-    new_cap = (new_cap + 63) & ~(size_t)63;  // Align to 64 bytes
+// Ensure the batch row table has room for rows + 1 entries
+static inline bool iter_ensure_rows(cisv_iterator_t *it, size_t rows) {
+    if (rows + 1 <= it->row_capacity) return true;
 
-    char *new_data = realloc(it->field_data, new_cap);
-    if (!new_data) return false;
+    size_t new_cap = it->row_capacity ? it->row_capacity * 2 : ITER_INITIAL_ROWS;
+    if (new_cap < rows + 1) new_cap = rows + 1;
 
-    // Update field pointers if data moved
-    if (new_data != it->field_data) {
-        ptrdiff_t offset = new_data - it->field_data;
-        for (size_t i = 0; i < it->field_count; i++) {
-            it->fields[i] += offset;
-        }
-    }
+    size_t *new_offsets = realloc(it->row_offsets, new_cap * sizeof(size_t));
+    if (!new_offsets) return false;
 
-    it->field_data = new_data;
-    it->field_data_cap = new_cap;
+    it->row_offsets = new_offsets;
+    it->row_capacity = new_cap;
     return true;
 }
 
-// Ensure quote buffer has space
-static inline bool iter_ensure_quote_buffer(cisv_iterator_t *it, size_t needed) {
-    size_t required = it->quote_buffer_pos + needed;
-    if (required <= it->quote_buffer_size) return true;
+// Add a field span to current row
+static inline bool iter_add_field(cisv_iterator_t *it, const uint8_t *start, size_t len) {
+    size_t col = it->current_col++;
+    if (col == 0) it->first_len = len;
+    if (!select_mask_has(it->select_mask, it->select_mask_cols, col)) return true;
 
-    size_t new_size = it->quote_buffer_size + (it->quote_buffer_size >> 1);
-    if (new_size < required) new_size = required;
-    if (new_size > MAX_QUOTE_BUFFER_SIZE) return false;
+    if (!iter_ensure_fields(it, 1)) return false;
 
-    uint8_t *new_buf = realloc(it->quote_buffer, new_size);
-    if (!new_buf) return false;
+    it->fields[it->field_count] = (char *)start;
+    it->lengths[it->field_count] = len;
+    it->field_count++;
+    return true;
+}
 
-    it->quote_buffer = new_buf;
-    it->quote_buffer_size = new_size;
+// Append bytes to the scratch buffer
+static inline bool iter_scratch_append(cisv_iterator_t *it, const uint8_t *src, size_t n) {
+    if (it->scratch_len + n > it->scratch_cap) {
+        size_t new_cap = it->scratch_cap ? it->scratch_cap * 2 : 256;
+        while (new_cap < it->scratch_len + n) new_cap *= 2;
+        uint8_t *scratch = realloc(it->scratch, new_cap);
+        if (!scratch) return false;
+        it->scratch = scratch;
+        it->scratch_cap = new_cap;
+    }
+    memcpy(it->scratch + it->scratch_len, src, n);
+    it->scratch_len += n;
     return true;
 }
 
-// Add a field to current row
-static inline bool iter_add_field(cisv_iterator_t *it, const uint8_t *start, size_t len) {
-    if (!iter_ensure_fields(it, 1)) return false;
-    if (!iter_ensure_data(it, len)) return false;
+// Add a field unescaped into scratch at offset off
+static bool iter_add_scratch_field(cisv_iterator_t *it, size_t off, size_t len) {
+    size_t index = it->field_count;
+    if (!iter_add_field(it, NULL, len)) return false;
+    if (it->field_count == index) return true;  // Not a selected column
+
+    if (it->scratch_count == it->scratch_fields_cap) {
+        size_t new_cap = it->scratch_fields_cap ? it->scratch_fields_cap * 2 : 16;
+        size_t *list = realloc(it->scratch_fields, new_cap * sizeof(size_t));
+        if (!list) return false;
+        it->scratch_fields = list;
+        it->scratch_fields_cap = new_cap;
+    }
+    it->fields[index] = (char *)(uintptr_t)off;
+    it->scratch_fields[it->scratch_count++] = index;
+    return true;
+}
 
-    // Copy field data
-    char *field_ptr = it->field_data + it->field_data_len;
-    memcpy(field_ptr, start, len);
-    field_ptr[len] = '\0';  // Null-terminate
+// Drop the scratch fields of a row that is read again from row_first
+static inline void iter_drop_scratch_fields(cisv_iterator_t *it, size_t row_first) {
+    while (it->scratch_count > 0 && it->scratch_fields[it->scratch_count - 1] >= row_first) {
+        it->scratch_count--;
+    }
+}
 
-    it->fields[it->field_count] = field_ptr;
-    it->lengths[it->field_count] = len;
-    it->field_count++;
-    it->field_data_len += len + 1;
+// Point the scratch fields at their final bytes before handing rows out
+static inline void iter_resolve_scratch(cisv_iterator_t *it) {
+    for (size_t i = 0; i < it->scratch_count; i++) {
+        size_t index = it->scratch_fields[i];
+        it->fields[index] = (char *)it->scratch + (uintptr_t)it->fields[index];
+    }
+}
 
-    return true;
+// Start a new row (or batch): earlier scratch fields are no longer handed out
+static inline void iter_reset_scratch(cisv_iterator_t *it) {
+    it->scratch_len = 0;
+    it->scratch_count = 0;
 }
 
-// Add a field from quote buffer (for fields with escaped quotes)
-static inline bool iter_add_quoted_field(cisv_iterator_t *it) {
-    bool result = iter_add_field(it, it->quote_buffer, it->quote_buffer_pos);
-    it->quote_buffer_pos = 0;
-    return result;
+// True when the row read so far is a single empty field
+#define iter_row_is_empty(it) ((it)->current_col == 1 && (it)->first_len == 0)
+
+// iter_read_row ran into the end of a window that is not the end of the file
+#define ITER_NEED_WINDOW 1
+
+// Map the window holding file offset onward. When the previous window could
+// not hold one row, the new one grows to cover past its end. Row spans of
+// the previous window become invalid.
+static int iter_map_window(cisv_iterator_t *it, size_t offset) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t start = offset & ~(page - 1);
+    size_t old_end = it->data ? it->map_offset + it->map_len : 0;
+    size_t len = it->window;
+
+    if (start + len <= old_end) len = (old_end - start) * 2;
+    if (len > it->file_size - start) len = it->file_size - start;
+
+    if (it->data) {
+        munmap(it->data, it->map_len);
+        it->data = NULL;
+    }
+
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+
+    uint8_t *data = (uint8_t*)mmap(NULL, len, PROT_READ, flags, it->fd, (off_t)start);
+    if (data == MAP_FAILED) return -errno;
+
+    // Advise kernel for sequential access
+    madvise(data, len, MADV_SEQUENTIAL);
+    madvise(data, len, MADV_WILLNEED);
+
+    it->data = data;
+    it->map_offset = start;
+    it->map_len = len;
+    it->map_last = start + len >= it->file_size;
+    it->pos = data + (offset - start);
+    it->end = data + len;
+    it->block_base = NULL;
+    return 0;
 }
 
 cisv_iterator_t *cisv_iterator_open(const char *path, const cisv_config *config) {
@@ -2809,34 +7439,22 @@ cisv_iterator_t *cisv_iterator_open(const char *path, const cisv_config *config)
         return it;
     }
 
-    int flags = MAP_PRIVATE;
-#ifdef MAP_POPULATE
-    flags |= MAP_POPULATE;
-#endif
-
-    uint8_t *data = (uint8_t*)mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
-    if (data == MAP_FAILED) {
-        close(fd);
-        return NULL;
-    }
-
-    // Advise kernel for sequential access
-    madvise(data, st.st_size, MADV_SEQUENTIAL | MADV_WILLNEED);
-
     cisv_iterator_t *it = calloc(1, sizeof(cisv_iterator_t));
     if (!it) {
-        munmap(data, st.st_size);
         close(fd);
         errno = ENOMEM;
         return NULL;
     }
 
     it->fd = fd;
-    it->data = data;
     it->file_size = st.st_size;
-    it->pos = data;
-    it->end = data + st.st_size;
-    it->state = S_NORMAL;
+    it->window = mmap_window_for(config ? config->mmap_window : 0, it->file_size);
+    int map_err = iter_map_window(it, 0);
+    if (map_err < 0) {
+        cisv_iterator_close(it);
+        errno = -map_err;
+        return NULL;
+    }
 
     // Config
     if (config) {
@@ -2844,6 +7462,8 @@ cisv_iterator_t *cisv_iterator_open(const char *path, const cisv_config *config)
         it->quote = config->quote;
         it->trim = config->trim;
         it->skip_empty_lines = config->skip_empty_lines;
+        it->select_mask = build_select_mask(config->select_columns, config->select_count,
+                                            &it->select_mask_cols);
     } else {
         it->delimiter = ',';
         it->quote = '"';
@@ -2855,12 +7475,10 @@ cisv_iterator_t *cisv_iterator_open(const char *path, const cisv_config *config)
     it->field_capacity = ITER_INITIAL_FIELDS;
     it->fields = malloc(it->field_capacity * sizeof(char*));
     it->lengths = malloc(it->field_capacity * sizeof(size_t));
-    it->field_data_cap = ITER_INITIAL_DATA;
-    it->field_data = malloc(it->field_data_cap);
-    it->quote_buffer_size = 4096;
-    it->quote_buffer = malloc(it->quote_buffer_size);
 
-    if (!it->fields || !it->lengths || !it->field_data || !it->quote_buffer) {
+    bool mask_failed = config && config->select_columns && config->select_count > 0 &&
+                       !it->select_mask;
+    if (!it->fields || !it->lengths || mask_failed) {
         cisv_iterator_close(it);
         errno = ENOMEM;
         return NULL;
@@ -2875,54 +7493,156 @@ static inline void iter_trim_field(const uint8_t **start, const uint8_t **end) {
     while (*start < *end && is_ws(*(*end - 1))) (*end)--;
 }
 
-int cisv_iterator_next(cisv_iterator_t *it,
-                       const char ***fields,
-                       const size_t **lengths,
-                       size_t *field_count) {
-    if (!it || it->eof) {
-        if (fields) *fields = NULL;
-        if (lengths) *lengths = NULL;
-        if (field_count) *field_count = 0;
-        return CISV_ITER_EOF;
+// Classify the 64-byte block at base (zero-padded at the end of the file)
+static inline void iter_classify(cisv_iterator_t *it, const uint8_t *base) {
+    uint8_t tail[64];
+    const uint8_t *block = base;
+    size_t remaining = (size_t)(it->end - base);
+
+    if (remaining < 64) {
+        memset(tail, 0, sizeof(tail));
+        memcpy(tail, base, remaining);
+        block = tail;
     }
 
-    // Reset row state
-    it->field_count = 0;
-    it->field_data_len = 0;
+    uint64_t quote_bits, delim_bits, nl_bits;
+    bitmask_classify_block(block, (uint8_t)it->delimiter, (uint8_t)it->quote,
+                           &quote_bits, &delim_bits, &nl_bits);
+    it->block_base = base;
+    it->quote_bits = quote_bits;
+    it->sep_bits = delim_bits | nl_bits;
+}
+
+// First quote (want_quote) or delimiter/newline at or after from, or end.
+// Blocks are aligned to the mapping, so consecutive short fields share one
+// classification and the scan only ever moves forward.
+static inline const uint8_t *iter_find(cisv_iterator_t *it, const uint8_t *from, bool want_quote) {
+    while (from < it->end) {
+        const uint8_t *base = it->data + ((size_t)(from - it->data) & ~(size_t)63);
+        if (base != it->block_base) iter_classify(it, base);
+
+        uint64_t bits = (want_quote ? it->quote_bits : it->sep_bits) >> (from - base);
+        if (bits) {
+            const uint8_t *hit = from + __builtin_ctzll(bits);
+            return hit < it->end ? hit : it->end;
+        }
+        from = base + 64;
+    }
+    return it->end;
+}
+
+// Scan the quoted field whose opening quote is at q into [*start, *start + *len).
+// Without "" pairs the span points into the mapping; otherwise the field is
+// unescaped into scratch and *unescaped is set. Returns the position just
+// past the closing quote (end if unterminated), or NULL when out of memory.
+static inline const uint8_t *iter_scan_quoted(cisv_iterator_t *it, const uint8_t *q,
+                                              const uint8_t **start, size_t *len,
+                                              bool *unescaped) {
+    const uint8_t *first = q + 1;
+    const uint8_t *hit = iter_find(it, first, true);
+    *unescaped = false;
+
+    if (hit >= it->end || hit + 1 >= it->end || hit[1] != (uint8_t)it->quote) {
+        *start = first;
+        *len = (size_t)(hit - first);
+        return hit >= it->end ? it->end : hit + 1;
+    }
+
+    // Escaped quotes: copy the runs between them, keeping one quote per pair
+    size_t off = it->scratch_len;
+    const uint8_t *r = first;
+    for (;;) {
+        if (!iter_scratch_append(it, r, (size_t)(hit - r))) return NULL;
+        if (hit >= it->end) {
+            r = it->end;
+            break;
+        }
+        if (hit + 1 < it->end && hit[1] == (uint8_t)it->quote) {
+            if (!iter_scratch_append(it, hit, 1)) return NULL;
+            r = hit + 2;
+            hit = iter_find(it, r, true);
+            continue;
+        }
+        r = hit + 1;
+        break;
+    }
+
+    *unescaped = true;
+    *start = it->scratch + off;
+    *len = it->scratch_len - off;
+    return r;
+}
+
+// Read one row, appending its fields after it->field_count. Returns
+// CISV_ITER_OK, CISV_ITER_EOF (no row left), CISV_ITER_ERROR, or
+// ITER_NEED_WINDOW with it->pos left at the row start when the row runs
+// past a window that does not end the file.
+static int iter_read_row(cisv_iterator_t *it) {
+    size_t row_first = it->field_count;
 
 restart_row:
+    it->field_count = row_first;
+    it->current_col = 0;
+    iter_drop_scratch_fields(it, row_first);
     if (it->pos >= it->end) {
+        if (!it->map_last) return ITER_NEED_WINDOW;
         it->eof = true;
-        if (fields) *fields = NULL;
-        if (lengths) *lengths = NULL;
-        if (field_count) *field_count = 0;
         return CISV_ITER_EOF;
     }
 
-    const uint8_t *field_start = it->pos;
-    it->state = S_NORMAL;
+    const uint8_t *p = it->pos;
+
+    for (;;) {
+        // p is the start of a field
+        if (p < it->end && *p == (uint8_t)it->quote) {
+            const uint8_t *field_start;
+            size_t len;
+            bool unescaped;
+            p = iter_scan_quoted(it, p, &field_start, &len, &unescaped);
+            if (!p) {
+                it->error_code = ENOMEM;
+                return CISV_ITER_ERROR;
+            }
+
+            const uint8_t *field_end = field_start + len;
+            if (it->trim) {
+                iter_trim_field(&field_start, &field_end);
+            }
+            bool added = unescaped
+                ? iter_add_scratch_field(it, (size_t)(field_start - it->scratch),
+                                         (size_t)(field_end - field_start))
+                : iter_add_field(it, field_start, (size_t)(field_end - field_start));
+            if (!added) {
+                it->error_code = ENOMEM;
+                return CISV_ITER_ERROR;
+            }
 
-    // Parse until end of row
-    while (it->pos < it->end) {
-        uint8_t c = *it->pos;
+            // Skip delimiter or newline after closing quote
+            if (p >= it->end) {
+                if (!it->map_last) goto need_window;
+                break;
+            }
+            if (*p == (uint8_t)it->delimiter) {
+                p++;
+            } else if (*p == '\n') {
+                p++;
+                goto row_done;
+            } else if (*p == '\r' && p + 1 < it->end && p[1] == '\n') {
+                p += 2;
+                goto row_done;
+            }
+            // Anything else after the closing quote starts a new field
+            continue;
+        }
 
-        if (it->state == S_NORMAL) {
-            if (c == it->delimiter) {
-                // End of field
-                const uint8_t *field_end = it->pos;
-                if (it->trim) {
-                    iter_trim_field(&field_start, &field_end);
-                }
-                if (!iter_add_field(it, field_start, field_end - field_start)) {
-                    it->error_code = ENOMEM;
-                    return CISV_ITER_ERROR;
-                }
-                it->pos++;
-                field_start = it->pos;
-            } else if (c == '\n') {
-                // End of row
-                const uint8_t *field_end = it->pos;
-                // Handle CRLF
+        const uint8_t *sep = iter_find(it, p, false);
+        if (sep >= it->end) {
+            if (!it->map_last) goto need_window;
+            // End of file - handle last field if any
+            if (p < it->end) {
+                const uint8_t *field_start = p;
+                const uint8_t *field_end = it->end;
+                // Handle trailing CR
                 if (field_end > field_start && *(field_end - 1) == '\r') {
                     field_end--;
                 }
@@ -2933,172 +7653,162 @@ restart_row:
                     it->error_code = ENOMEM;
                     return CISV_ITER_ERROR;
                 }
-                it->pos++;
-
-                // Skip empty rows if configured
-                if (it->skip_empty_lines && it->field_count == 1 && it->lengths[0] == 0) {
-                    it->field_count = 0;
-                    it->field_data_len = 0;
-                    goto restart_row;
-                }
-
-                // Success - row complete
-                if (fields) *fields = (const char **)it->fields;
-                if (lengths) *lengths = it->lengths;
-                if (field_count) *field_count = it->field_count;
-                return CISV_ITER_OK;
-
-            } else if (c == it->quote && it->pos == field_start) {
-                // Start of quoted field
-                it->state = S_QUOTED;
-                it->quote_buffer_pos = 0;
-                it->pos++;
-            } else {
-                it->pos++;
-            }
-        } else {
-            // S_QUOTED state
-            if (c == it->quote) {
-                // Check for escaped quote
-                if (it->pos + 1 < it->end && *(it->pos + 1) == it->quote) {
-                    // Escaped quote - add one quote to buffer
-                    if (!iter_ensure_quote_buffer(it, 1)) {
-                        it->error_code = ENOMEM;
-                        return CISV_ITER_ERROR;
-                    }
-                    it->quote_buffer[it->quote_buffer_pos++] = it->quote;
-                    it->pos += 2;
-                } else {
-                    // End of quoted field
-                    if (it->trim) {
-                        // Trim the quote buffer content
-                        const uint8_t *qstart = it->quote_buffer;
-                        const uint8_t *qend = it->quote_buffer + it->quote_buffer_pos;
-                        iter_trim_field(&qstart, &qend);
-                        it->quote_buffer_pos = qend - qstart;
-                        if (qstart != it->quote_buffer) {
-                            memmove(it->quote_buffer, qstart, it->quote_buffer_pos);
-                        }
-                    }
-                    if (!iter_add_quoted_field(it)) {
-                        it->error_code = ENOMEM;
-                        return CISV_ITER_ERROR;
-                    }
-                    it->state = S_NORMAL;
-                    it->pos++;
-
-                    // Skip delimiter or newline after closing quote
-                    if (it->pos < it->end) {
-                        if (*it->pos == it->delimiter) {
-                            it->pos++;
-                            field_start = it->pos;
-                        } else if (*it->pos == '\n') {
-                            it->pos++;
-
-                            // Skip empty rows if configured
-                            if (it->skip_empty_lines && it->field_count == 1 && it->lengths[0] == 0) {
-                                it->field_count = 0;
-                                it->field_data_len = 0;
-                                goto restart_row;
-                            }
-
-                            // Success - row complete
-                            if (fields) *fields = (const char **)it->fields;
-                            if (lengths) *lengths = it->lengths;
-                            if (field_count) *field_count = it->field_count;
-                            return CISV_ITER_OK;
-                        } else if (*it->pos == '\r' && it->pos + 1 < it->end && *(it->pos + 1) == '\n') {
-                            it->pos += 2;
-
-                            // Skip empty rows if configured
-                            if (it->skip_empty_lines && it->field_count == 1 && it->lengths[0] == 0) {
-                                it->field_count = 0;
-                                it->field_data_len = 0;
-                                goto restart_row;
-                            }
-
-                            // Success - row complete
-                            if (fields) *fields = (const char **)it->fields;
-                            if (lengths) *lengths = it->lengths;
-                            if (field_count) *field_count = it->field_count;
-                            return CISV_ITER_OK;
-                        }
-                    }
-                    field_start = it->pos;
-                }
-            } else {
-                // Regular character in quoted field
-                if (!iter_ensure_quote_buffer(it, 1)) {
-                    it->error_code = ENOMEM;
-                    return CISV_ITER_ERROR;
-                }
-                it->quote_buffer[it->quote_buffer_pos++] = c;
-                it->pos++;
             }
+            p = it->end;
+            break;
         }
-    }
 
-    // End of file - handle last field if any
-    if (field_start < it->end || it->quote_buffer_pos > 0) {
-        if (it->state == S_QUOTED) {
-            // Unterminated quote - yield what we have
-            if (it->trim) {
-                const uint8_t *qstart = it->quote_buffer;
-                const uint8_t *qend = it->quote_buffer + it->quote_buffer_pos;
-                iter_trim_field(&qstart, &qend);
-                it->quote_buffer_pos = qend - qstart;
-                if (qstart != it->quote_buffer) {
-                    memmove(it->quote_buffer, qstart, it->quote_buffer_pos);
-                }
-            }
-            if (!iter_add_quoted_field(it)) {
-                it->error_code = ENOMEM;
-                return CISV_ITER_ERROR;
-            }
-        } else {
-            const uint8_t *field_end = it->end;
-            // Handle trailing CR
-            if (field_end > field_start && *(field_end - 1) == '\r') {
-                field_end--;
-            }
-            if (it->trim) {
-                iter_trim_field(&field_start, &field_end);
-            }
-            if (!iter_add_field(it, field_start, field_end - field_start)) {
-                it->error_code = ENOMEM;
-                return CISV_ITER_ERROR;
-            }
+        const uint8_t *field_start = p;
+        const uint8_t *field_end = sep;
+        bool row_end = *sep == '\n';
+        // Handle CRLF
+        if (row_end && field_end > field_start && *(field_end - 1) == '\r') {
+            field_end--;
         }
+        if (it->trim) {
+            iter_trim_field(&field_start, &field_end);
+        }
+        if (!iter_add_field(it, field_start, field_end - field_start)) {
+            it->error_code = ENOMEM;
+            return CISV_ITER_ERROR;
+        }
+        p = sep + 1;
+        if (row_end) goto row_done;
     }
 
+    // Reached end of file inside the row
+    it->pos = it->end;
     it->eof = true;
 
     // Skip empty final row if configured
-    if (it->skip_empty_lines && it->field_count == 1 && it->lengths[0] == 0) {
-        if (fields) *fields = NULL;
-        if (lengths) *lengths = NULL;
-        if (field_count) *field_count = 0;
+    if (it->skip_empty_lines && iter_row_is_empty(it)) {
+        it->field_count = row_first;
         return CISV_ITER_EOF;
     }
+    if (it->current_col > 0) return CISV_ITER_OK;
+
+    it->field_count = row_first;
+    return CISV_ITER_EOF;
+
+row_done:
+    it->pos = p;
+
+    // Skip empty rows if configured
+    if (it->skip_empty_lines && iter_row_is_empty(it)) {
+        goto restart_row;
+    }
+    return CISV_ITER_OK;
+
+need_window:
+    it->field_count = row_first;
+    it->current_col = 0;
+    iter_drop_scratch_fields(it, row_first);
+    return ITER_NEED_WINDOW;
+}
+
+// Slide the window forward so the row starting at it->pos can be read
+static inline int iter_advance_window(cisv_iterator_t *it) {
+    int err = iter_map_window(it, it->map_offset + (size_t)(it->pos - it->data));
+    if (err < 0) {
+        it->error_code = -err;
+        return CISV_ITER_ERROR;
+    }
+    return CISV_ITER_OK;
+}
+
+int cisv_iterator_next(cisv_iterator_t *it,
+                       const char ***fields,
+                       const size_t **lengths,
+                       size_t *field_count) {
+    int rc = CISV_ITER_EOF;
+
+    if (it && !it->eof) {
+        it->field_count = 0;
+        iter_reset_scratch(it);
+        rc = CISV_ITER_OK;
+        if (it->remap_pending) {
+            it->remap_pending = false;
+            rc = iter_advance_window(it);
+        }
+        if (rc == CISV_ITER_OK) rc = iter_read_row(it);
+        while (rc == ITER_NEED_WINDOW) {
+            rc = iter_advance_window(it);
+            if (rc == CISV_ITER_OK) rc = iter_read_row(it);
+        }
+    }
 
-    if (it->field_count > 0) {
+    if (rc == CISV_ITER_OK) {
+        iter_resolve_scratch(it);
         if (fields) *fields = (const char **)it->fields;
         if (lengths) *lengths = it->lengths;
         if (field_count) *field_count = it->field_count;
-        return CISV_ITER_OK;
+    } else {
+        if (fields) *fields = NULL;
+        if (lengths) *lengths = NULL;
+        if (field_count) *field_count = 0;
+    }
+    return rc;
+}
+
+int cisv_iterator_next_batch(cisv_iterator_t *it, size_t max_rows,
+                             cisv_iterator_batch_t *batch) {
+    if (!batch) {
+        errno = EINVAL;
+        return CISV_ITER_ERROR;
     }
+    memset(batch, 0, sizeof(*batch));
+    if (!it || it->eof) return CISV_ITER_EOF;
+    if (max_rows == 0) max_rows = ITER_DEFAULT_BATCH;
 
-    if (fields) *fields = NULL;
-    if (lengths) *lengths = NULL;
-    if (field_count) *field_count = 0;
-    return CISV_ITER_EOF;
+    size_t rows = 0;
+    it->field_count = 0;
+    iter_reset_scratch(it);
+
+    if (it->remap_pending) {
+        it->remap_pending = false;
+        if (iter_advance_window(it) != CISV_ITER_OK) return CISV_ITER_ERROR;
+    }
+
+    while (rows < max_rows) {
+        if (!iter_ensure_rows(it, rows + 1)) {
+            it->error_code = ENOMEM;
+            return CISV_ITER_ERROR;
+        }
+        size_t row_start = it->field_count;
+        int rc = iter_read_row(it);
+        if (rc == ITER_NEED_WINDOW) {
+            // Rows already in the batch point into the current window, so
+            // the next call remaps before reading the partial row again.
+            if (rows > 0) {
+                it->remap_pending = true;
+                break;
+            }
+            rc = iter_advance_window(it);
+            if (rc == CISV_ITER_OK) continue;
+        }
+        if (rc == CISV_ITER_ERROR) return CISV_ITER_ERROR;
+        if (rc == CISV_ITER_EOF) break;
+        it->row_offsets[rows++] = row_start;
+        if (it->eof) break;
+    }
+
+    if (rows == 0) return CISV_ITER_EOF;
+
+    it->row_offsets[rows] = it->field_count;
+    iter_resolve_scratch(it);
+    batch->fields = (const char **)it->fields;
+    batch->lengths = it->lengths;
+    batch->row_offsets = it->row_offsets;
+    batch->row_count = rows;
+    batch->field_count = it->field_count;
+    return CISV_ITER_OK;
 }
 
 void cisv_iterator_close(cisv_iterator_t *it) {
     if (!it) return;
 
-    if (it->data && it->file_size > 0) {
-        munmap(it->data, it->file_size);
+    if (it->data) {
+        munmap(it->data, it->map_len);
     }
     if (it->fd >= 0) {
         close(it->fd);
@@ -3106,7 +7816,9 @@ void cisv_iterator_close(cisv_iterator_t *it) {
 
     free(it->fields);
     free(it->lengths);
-    free(it->field_data);
-    free(it->quote_buffer);
+    free(it->row_offsets);
+    free(it->scratch);
+    free(it->scratch_fields);
+    free(it->select_mask);
     free(it);
 }
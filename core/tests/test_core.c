@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <errno.h>
 #include "cisv/parser.h"
 #include "cisv/writer.h"
 #include "cisv/transformer.h"
@@ -291,6 +292,317 @@ void test_transform_pipeline(void) {
     }
 }
 
+// Test: Transform results come from the pipeline pool and are reset per row
+void test_transform_arena(void) {
+    TEST("transform arena (chained results, reset per row, growth)");
+
+    cisv_transform_pipeline_t *pipeline = cisv_transform_pipeline_create(4);
+    if (!pipeline) {
+        FAIL("failed to create pipeline");
+        return;
+    }
+
+    cisv_transform_pipeline_add(pipeline, 0, TRANSFORM_TRIM, NULL);
+    cisv_transform_pipeline_add(pipeline, 0, TRANSFORM_UPPERCASE, NULL);
+    cisv_transform_pipeline_add(pipeline, 0, TRANSFORM_BASE64_ENCODE, NULL);
+    cisv_transform_pipeline_add(pipeline, 1, TRANSFORM_TO_INT, NULL);
+    cisv_transform_pipeline_add(pipeline, 2, TRANSFORM_TO_FLOAT, NULL);
+
+    int success = 1;
+    for (int row = 0; row < 1000 && success; row++) {
+        cisv_transform_result_t r0 = cisv_transform_apply(pipeline, 0, "  abc  ", 7);
+        cisv_transform_result_t r1 = cisv_transform_apply(pipeline, 1, "-42x", 4);
+        cisv_transform_result_t r2 = cisv_transform_apply(pipeline, 2, "2.5", 3);
+        success = !r0.needs_free && !r1.needs_free && !r2.needs_free &&
+                  strcmp(r0.data, "QUJD") == 0 && strcmp(r1.data, "-42") == 0 &&
+                  strcmp(r2.data, "2.500000") == 0;
+        cisv_transform_pipeline_reset(pipeline);
+        success = success && pipeline->pool_used == 0;
+    }
+
+    // A field larger than the pool spills to malloc, then the pool grows
+    size_t big_len = pipeline->pool_size + 100;
+    char *big = malloc(big_len);
+    if (big) {
+        memset(big, 'x', big_len);
+        cisv_transform_result_t spilled = cisv_transform_apply(pipeline, 0, big, big_len);
+        success = success && spilled.needs_free && spilled.len == (big_len + 2) / 3 * 4;
+        cisv_transform_result_free(&spilled);
+        cisv_transform_pipeline_reset(pipeline);
+
+        cisv_transform_result_t pooled = cisv_transform_apply(pipeline, 0, big, big_len);
+        success = success && !pooled.needs_free && pooled.len == (big_len + 2) / 3 * 4 &&
+                  strncmp(pooled.data, "WFhY", 4) == 0;
+        cisv_transform_result_free(&pooled);
+        free(big);
+    }
+    cisv_transform_pipeline_destroy(pipeline);
+
+    if (success && big) {
+        PASS();
+    } else {
+        FAIL("arena transform results incorrect");
+    }
+}
+
+// Test: Column-batch transforms match per-field results
+void test_transform_column(void) {
+    TEST("column-batch transforms (columnar and gather slices)");
+
+    const char *csv = "  alpha  ,12\nBeta,-340\n\t gamma\t,+7x\n,\nlonger value for the simd path ,123456789012\n";
+    cisv_config config;
+    cisv_config_init(&config);
+    cisv_columnar_t *cols = cisv_parse_string_columnar(csv, strlen(csv), &config);
+    cisv_transform_pipeline_t *pipeline = cisv_transform_pipeline_create(4);
+    if (!cols || cols->column_count != 2 || !pipeline) {
+        cisv_columnar_free(cols);
+        cisv_transform_pipeline_destroy(pipeline);
+        FAIL("setup failed");
+        return;
+    }
+    cisv_transform_pipeline_add(pipeline, 0, TRANSFORM_TRIM, NULL);
+    cisv_transform_pipeline_add(pipeline, 0, TRANSFORM_UPPERCASE, NULL);
+
+    const cisv_column_t *names = &cols->columns[0];
+    cisv_string_slice_t slice = {
+        .data = names->values, .offsets = names->offsets, .offsets64 = names->offsets64,
+        .count = names->length
+    };
+    cisv_string_batch_t out = {0};
+    int success = cisv_transform_apply_column(pipeline, 0, &slice, &out) == 0 &&
+                  out.count == names->length;
+    for (size_t i = 0; success && i < out.count; i++) {
+        size_t len;
+        const char *v = cisv_column_value(names, i, &len);
+        cisv_transform_result_t r = cisv_transform_apply(pipeline, 0, v, len);
+        success = (size_t)(out.offsets[i + 1] - out.offsets[i]) == r.len &&
+                  memcmp(out.data + out.offsets[i], r.data, r.len) == 0;
+    }
+    success = success && out.count > 4 &&
+              memcmp(out.data + out.offsets[2], "GAMMA", 5) == 0;
+
+    // Gather form over the second column, parsed straight to int64
+    const char *values[5];
+    size_t lengths[5];
+    for (size_t i = 0; i < 5; i++) values[i] = cisv_column_value(&cols->columns[1], i, &lengths[i]);
+    cisv_string_slice_t gather = { .values = values, .lengths = lengths, .count = 5 };
+    int64_t ints[5];
+    success = success && cisv_transform_column_to_int64(&gather, ints) == 0 &&
+              ints[0] == 12 && ints[1] == -340 && ints[2] == 7 && ints[3] == 0 &&
+              ints[4] == 123456789012LL;
+
+    cisv_string_batch_free(&out);
+    cisv_transform_pipeline_destroy(pipeline);
+    cisv_columnar_free(cols);
+
+    if (success) {
+        PASS();
+    } else {
+        FAIL("column transform results differ from per-field apply");
+    }
+}
+
+// Test: Hash transforms match the reference digests, per field and per column
+void test_transform_hash(void) {
+    TEST("hash transforms (sha256, md5, xxh3; column lanes)");
+
+    cisv_transform_result_t sha = cisv_transform_hash_sha256("abc", 3, NULL);
+    cisv_transform_result_t empty = cisv_transform_hash_sha256("", 0, NULL);
+    cisv_transform_result_t md5 = cisv_transform_hash_md5("abc", 3, NULL);
+    cisv_transform_result_t xxh = cisv_transform_hash_xxh3("abc", 3, NULL);
+    int success = sha.data && empty.data && md5.data && xxh.data &&
+        strcmp(sha.data, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad") == 0 &&
+        strcmp(empty.data, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855") == 0 &&
+        strcmp(md5.data, "900150983cd24fb0d6963f7d28e17f72") == 0 &&
+        strcmp(xxh.data, "78af5f94892f3950") == 0;
+    cisv_transform_result_free(&sha);
+    cisv_transform_result_free(&empty);
+    cisv_transform_result_free(&md5);
+    cisv_transform_result_free(&xxh);
+
+    // Mixed lengths so the column path exercises partial lane groups and the
+    // single-stream fallback for long values
+    char buf[300];
+    memset(buf, 'a', sizeof(buf));
+    const char *values[13];
+    size_t lengths[13];
+    for (size_t i = 0; i < 13; i++) {
+        values[i] = buf;
+        lengths[i] = (i * 37) % 260;
+    }
+    lengths[12] = 300;
+    cisv_string_slice_t gather = { .values = values, .lengths = lengths, .count = 13 };
+
+    cisv_transform_type_t types[3] = { TRANSFORM_HASH_SHA256, TRANSFORM_HASH_MD5, TRANSFORM_HASH_XXH3 };
+    cisv_string_batch_t out = {0};
+    for (int t = 0; success && t < 3; t++) {
+        success = cisv_transform_column(types[t], &gather, &out) == 0 && out.count == 13;
+        for (size_t i = 0; success && i < 13; i++) {
+            cisv_transform_result_t r = types[t] == TRANSFORM_HASH_SHA256
+                ? cisv_transform_hash_sha256(buf, lengths[i], NULL)
+                : types[t] == TRANSFORM_HASH_MD5 ? cisv_transform_hash_md5(buf, lengths[i], NULL)
+                                                 : cisv_transform_hash_xxh3(buf, lengths[i], NULL);
+            success = (size_t)(out.offsets[i + 1] - out.offsets[i]) == r.len &&
+                      memcmp(out.data + out.offsets[i], r.data, r.len) == 0;
+            cisv_transform_result_free(&r);
+        }
+    }
+    cisv_transform_column(TRANSFORM_HASH_SHA256, &gather, &out);
+    success = success && out.count == 13 &&
+              memcmp(out.data + out.offsets[12],
+                     "9835fa6bf4e20a9b9ea812506302e98982721a6cf8d2cae67af57129bf21ae90", 64) == 0;
+    cisv_string_batch_free(&out);
+
+    if (success) {
+        PASS();
+    } else {
+        FAIL("hash digests incorrect");
+    }
+}
+
+// Pipelines take ownership of their contexts
+static cisv_transform_context_t *make_aes_ctx(const char *key, const char *iv) {
+    cisv_transform_context_t *ctx = calloc(1, sizeof(*ctx));
+    if (!ctx) return NULL;
+    ctx->key = strdup(key);
+    ctx->key_len = strlen(key);
+    ctx->iv = strdup(iv);
+    ctx->iv_len = strlen(iv);
+    return ctx;
+}
+
+// Test: AES-256-GCM/CTR transforms (NIST vector, tag check, per-row nonces)
+void test_transform_aes(void) {
+    TEST("aes256 transforms (gcm vector, random nonces, column vs per-field)");
+
+    const char *key = "feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308";
+    const char *iv = "cafebabefacedbaddecaf888";
+    static const char plain[] =
+        "\xd9\x31\x32\x25\xf8\x84\x06\xe5\xa5\x59\x09\xc5\xaf\xf5\x26\x9a"
+        "\x86\xa7\xa9\x53\x15\x34\xf7\xda\x2e\x4c\x30\x3d\x8a\x31\x8a\x72"
+        "\x1c\x3c\x0c\x95\x95\x68\x09\x53\x2f\xcf\x0e\x24\x49\xa6\xb5\x25"
+        "\xb1\x6a\xed\xf5\xaa\x0d\xe6\x57\xba\x63\x7b\x39\x1a\xaf\xd2\x55";
+    cisv_transform_context_t ctx = { (void *)key, strlen(key), (void *)iv, strlen(iv), NULL };
+
+    // GCM spec test case 15: ciphertext || tag. Field 0 of row 0 uses the
+    // IV itself as the nonce.
+    cisv_transform_pipeline_t *vector = cisv_transform_pipeline_create(1);
+    int success = vector &&
+        cisv_transform_pipeline_add(vector, 0, TRANSFORM_ENCRYPT_AES256, make_aes_ctx(key, iv)) == 0;
+    if (success) {
+        cisv_transform_result_t r = cisv_transform_apply(vector, 0, plain, 64);
+        success = r.len == 108 && strcmp(r.data,
+            "Ui3B8JlWfQf0fzejKoRCfWQ6jNy/5cDJdZiivSVV0aqMsI5IWQ27PaewixBWgog4xfYeY5O6egq8yfZiiYAVrbCU2sXZNHG97BpQInDjzGw=") == 0;
+        cisv_transform_result_free(&r);
+    }
+    cisv_transform_pipeline_destroy(vector);
+
+    // Standalone calls: fresh nonce each time, carried in front of the output
+    cisv_transform_result_t enc = cisv_transform_encrypt_aes256(plain, 64, &ctx);
+    cisv_transform_result_t again = cisv_transform_encrypt_aes256(plain, 64, &ctx);
+    success = success && enc.len == 124 && again.len == 124 &&
+              memcmp(enc.data, again.data, 16) != 0;
+    cisv_transform_result_t dec = cisv_transform_decrypt_aes256(enc.data, enc.len, &ctx);
+    success = success && dec.len == 64 && memcmp(dec.data, plain, 64) == 0;
+    cisv_transform_result_free(&dec);
+    dec = cisv_transform_decrypt_aes256(again.data, again.len, &ctx);
+    success = success && dec.len == 64 && memcmp(dec.data, plain, 64) == 0;
+    cisv_transform_result_free(&dec);
+    if (enc.len > 30) {
+        enc.data[30] ^= 1;
+        dec = cisv_transform_decrypt_aes256(enc.data, enc.len, &ctx);
+        success = success && dec.len == 0;
+        cisv_transform_result_free(&dec);
+    }
+    cisv_transform_result_free(&enc);
+    cisv_transform_result_free(&again);
+
+    enc = cisv_transform_encrypt_aes256_ctr(plain, 64, &ctx);
+    dec = cisv_transform_decrypt_aes256_ctr(enc.data, enc.len, &ctx);
+    success = success && enc.len == 104 && dec.len == 64 && memcmp(dec.data, plain, 64) == 0;
+    cisv_transform_result_free(&dec);
+    cisv_transform_result_free(&enc);
+
+    // Pipelines: keys are checked on add; nonces follow the row number
+    cisv_transform_pipeline_t *per_field = cisv_transform_pipeline_create(4);
+    cisv_transform_pipeline_t *column = cisv_transform_pipeline_create(4);
+    cisv_transform_pipeline_t *decrypt = cisv_transform_pipeline_create(4);
+    cisv_transform_context_t *bad = make_aes_ctx("short", iv);
+    success = success && per_field && column && decrypt &&
+              cisv_transform_pipeline_add(per_field, 1, TRANSFORM_ENCRYPT_AES256, bad) < 0 &&
+              cisv_transform_pipeline_add(per_field, 1, TRANSFORM_ENCRYPT_AES256, make_aes_ctx(key, iv)) == 0 &&
+              cisv_transform_pipeline_add(column, 1, TRANSFORM_ENCRYPT_AES256, make_aes_ctx(key, iv)) == 0 &&
+              cisv_transform_pipeline_add(decrypt, 1, TRANSFORM_DECRYPT_AES256, make_aes_ctx(key, iv)) == 0;
+    if (bad) {
+        free(bad->key);
+        free(bad->iv);
+        free(bad);
+    }
+
+    const char *values[20];
+    size_t lengths[20];
+    char text[2048];
+    memset(text, 'x', sizeof(text));
+    for (size_t i = 0; i < 20; i++) {
+        values[i] = text;
+        lengths[i] = (i * 97) % 300;
+    }
+    lengths[19] = sizeof(text);  // Longer than one keystream batch
+    cisv_string_slice_t slice = { .values = values, .lengths = lengths, .count = 20 };
+    cisv_string_batch_t sealed = {0}, opened = {0};
+    if (success) {
+        // Two slices of ten continue the row numbering like one of twenty
+        cisv_transform_pipeline_set_row(column, 100);
+        cisv_transform_pipeline_set_row(decrypt, 100);
+        cisv_string_slice_t head = { .values = values, .lengths = lengths, .count = 10 };
+        cisv_string_slice_t tail = { .values = values + 10, .lengths = lengths + 10, .count = 10 };
+        cisv_string_batch_t first = {0};
+        success = cisv_transform_apply_column(column, 1, &head, &first) == 0 &&
+                  cisv_transform_apply_column(column, 1, &tail, &sealed) == 0 &&
+                  column->row == 120;
+        cisv_transform_pipeline_set_row(column, 100);
+        cisv_string_batch_t whole = {0};
+        success = success && cisv_transform_apply_column(column, 1, &slice, &whole) == 0 &&
+                  whole.count == 20 &&
+                  first.offsets[10] == whole.offsets[10] &&
+                  memcmp(first.data, whole.data, (size_t)first.offsets[10]) == 0 &&
+                  sealed.offsets[10] == whole.offsets[20] - whole.offsets[10] &&
+                  memcmp(sealed.data, whole.data + whole.offsets[10], (size_t)sealed.offsets[10]) == 0;
+        cisv_string_batch_free(&first);
+        cisv_string_batch_free(&sealed);
+        sealed = whole;
+
+        cisv_transform_pipeline_set_row(per_field, 100);
+        for (size_t i = 0; success && i < 20; i++) {
+            cisv_transform_result_t r = cisv_transform_apply(per_field, 1, values[i], lengths[i]);
+            success = (size_t)(sealed.offsets[i + 1] - sealed.offsets[i]) == r.len &&
+                      memcmp(sealed.data + sealed.offsets[i], r.data, r.len) == 0;
+            cisv_transform_result_free(&r);
+            cisv_transform_pipeline_reset(per_field);
+        }
+        // Same value, different rows: different ciphertexts
+        success = success && memcmp(sealed.data + sealed.offsets[0], sealed.data + sealed.offsets[1], 8) != 0;
+
+        cisv_string_slice_t back = { .data = sealed.data, .offsets64 = sealed.offsets, .count = 20 };
+        success = success && cisv_transform_apply_column(decrypt, 1, &back, &opened) == 0;
+        for (size_t i = 0; success && i < 20; i++) {
+            success = (size_t)(opened.offsets[i + 1] - opened.offsets[i]) == lengths[i] &&
+                      memcmp(opened.data + opened.offsets[i], text, lengths[i]) == 0;
+        }
+    }
+    cisv_string_batch_free(&sealed);
+    cisv_string_batch_free(&opened);
+    cisv_transform_pipeline_destroy(per_field);
+    cisv_transform_pipeline_destroy(column);
+    cisv_transform_pipeline_destroy(decrypt);
+
+    if (success) {
+        PASS();
+    } else {
+        FAIL("aes transform results incorrect");
+    }
+}
+
 // Test: Writer basic
 void test_writer_basic(void) {
     TEST("writer basic");
@@ -838,6 +1150,1374 @@ void test_parallel_custom_quote_chunk_split(void) {
     }
 }
 
+// Threads in this process from /proc/self/status (-1 if unavailable)
+static int count_threads(void) {
+    FILE *f = fopen("/proc/self/status", "r");
+    if (!f) return -1;
+    char line[256];
+    int threads = -1;
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "Threads: %d", &threads) == 1) break;
+    }
+    fclose(f);
+    return threads;
+}
+
+void test_parallel_shared_pool(void) {
+    TEST("parallel parse shares one pool across thread counts");
+
+    char path[256];
+    snprintf(path, sizeof(path), "/tmp/test_cisv_parallel_pool_%d.csv", getpid());
+    FILE *f = fopen(path, "w");
+    if (!f) { FAIL("failed to create temp file"); return; }
+    for (int i = 0; i < 5000; i++) fprintf(f, "%d,\"value %d\",x\n", i, i);
+    fclose(f);
+
+    cisv_config config;
+    cisv_config_init(&config);
+
+    // Each distinct count used to start a pool of its own for good
+    int before = count_threads();
+    int ok = 1;
+    for (int threads = 1; ok && threads <= 6; threads++) {
+        int result_count = 0;
+        cisv_result_t **results = cisv_parse_file_parallel(path, &config, threads, &result_count);
+        size_t rows = 0;
+        for (int i = 0; results && i < result_count; i++) rows += results[i]->row_count;
+        ok = results && rows == 5000;
+        cisv_results_free(results, result_count);
+    }
+    int after = count_threads();
+    unlink(path);
+
+    if (ok && (before < 0 || after <= before + 6)) {
+        PASS();
+    } else {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "ok=%d threads before=%d after=%d", ok, before, after);
+        FAIL(buf);
+    }
+}
+
+void test_parse_file_quote_heavy(void) {
+    TEST("parse_file quote-heavy input across vector blocks");
+    reset_test_state();
+
+    // Quoted fields straddle 64-byte block boundaries and contain
+    // delimiters, CRLF/LF newlines and escaped quotes.
+    const char *csv =
+        "\"id\",\"a long quoted header value that spans well past one block\",\"c\"\r\n"
+        "\"1\",\"x,y\r\nz\",\"say \"\"hi\"\"\"\n"
+        "plain,\"\",\"tail with , comma and \"\"quote\"\" and padding....\"\n"
+        "\"unterminated";
+    const char *path = write_temp_csv(csv);
+    if (!path) { FAIL("failed to create temp file"); return; }
+
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = test_field_cb;
+    config.row_cb = test_row_cb;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&config);
+    if (!parser) { unlink(path); FAIL("failed to create parser"); return; }
+
+    int rc = cisv_parser_parse_file(parser, path);
+    cisv_parser_destroy(parser);
+    unlink(path);
+
+    if (rc == 0 && field_count == 10 && row_count == 4 &&
+        strcmp(stored_fields[0], "id") == 0 &&
+        strcmp(stored_fields[1], "a long quoted header value that spans well past one block") == 0 &&
+        strcmp(stored_fields[4], "x,y\r\nz") == 0 &&
+        strcmp(stored_fields[5], "say \"hi\"") == 0 &&
+        strcmp(stored_fields[6], "plain") == 0 &&
+        stored_field_lens[7] == 0 &&
+        strcmp(stored_fields[8], "tail with , comma and \"quote\" and padding....") == 0 &&
+        strcmp(stored_fields[9], "unterminated") == 0) {
+        PASS();
+    } else {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "unexpected result: rc=%d fields=%d rows=%d", rc, field_count, row_count);
+        FAIL(buf);
+    }
+}
+
+// Render stored fields as "[f0][f1]" plus the row count for comparison
+static void format_stored_fields(char *out, size_t cap) {
+    size_t n = (size_t)snprintf(out, cap, "rows=%d ", row_count);
+    for (int i = 0; i < stored_field_count && n < cap; i++) {
+        n += (size_t)snprintf(out + n, cap - n, "[%s]", stored_fields[i]);
+    }
+}
+
+void test_parse_file_stray_quote_matches_write(void) {
+    TEST("parse_file keeps bytes after a closing quote like parser_write");
+
+    // Bytes between a closing quote and the separator become their own
+    // field on the state-machine path; the whole-buffer path must agree.
+    static const char *inputs[] = {
+        "\"ab\"cd,e\n",
+        "\"q\"z",
+        "\"a\"b\"c\",d\n",
+        "x,\"ab\"cd\n1,2\n",
+        "\"ab\" ,e\n",
+        "\"a\"\"b\"x,y\n",
+        "padding,padding,padding,padding,padding,padding,padding,padding\n"
+        "\"ab\"cd,e\n\"a\"b\"c\",d\nx,\"q\"\"r\" ,\"s\"t\r\n\"tail\"z",
+    };
+
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = test_field_cb;
+    config.row_cb = test_row_cb;
+
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        char from_file[1024], from_write[1024];
+        const char *path = write_temp_csv(inputs[i]);
+        if (!path) { FAIL("failed to create temp file"); return; }
+
+        reset_test_state();
+        cisv_parser *parser = cisv_parser_create_with_config(&config);
+        if (!parser) { unlink(path); FAIL("failed to create parser"); return; }
+        int rc = cisv_parser_parse_file(parser, path);
+        cisv_parser_destroy(parser);
+        unlink(path);
+        format_stored_fields(from_file, sizeof(from_file));
+
+        reset_test_state();
+        parser = cisv_parser_create_with_config(&config);
+        if (!parser) { FAIL("failed to create parser"); return; }
+        cisv_parser_write(parser, (const uint8_t *)inputs[i], strlen(inputs[i]));
+        cisv_parser_end(parser);
+        cisv_parser_destroy(parser);
+        format_stored_fields(from_write, sizeof(from_write));
+
+        if (rc != 0 || strcmp(from_file, from_write) != 0) {
+            char buf[2200];
+            snprintf(buf, sizeof(buf), "input %zu: file %s, write %s", i, from_file, from_write);
+            FAIL(buf);
+            return;
+        }
+    }
+    PASS();
+}
+
+void test_structural_index_columns(void) {
+    TEST("structural index stage 2 column subset");
+    reset_test_state();
+
+    const char *csv = "id,name,note\r\n1,\"Smith, J\",\"a \"\"b\"\"\"\n2,Lee,\"multi\nline\"\n3,Kim,";
+    cisv_index_t *idx = cisv_index_build((const uint8_t *)csv, strlen(csv), NULL);
+    if (!idx) { FAIL("failed to build index"); return; }
+
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = test_field_cb;
+    config.row_cb = test_row_cb;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&config);
+    if (!parser) { cisv_index_free(idx); FAIL("failed to create parser"); return; }
+
+    const int cols[] = {2, 0};
+    int rc = cisv_parse_index(parser, idx, cols, 2);
+    cisv_parser_destroy(parser);
+
+    cisv_result_t *batch = cisv_parse_index_batch(idx, NULL, NULL, 0);
+    size_t idx_rows = idx->row_count;
+    size_t row3_fields = cisv_index_row_fields(idx, 3);
+    cisv_index_free(idx);
+
+    int batch_ok = batch && batch->row_count == 4 && batch->total_fields == 11 &&
+                   batch->rows[1].field_lengths[1] == 8 &&
+                   memcmp(batch->rows[1].fields[1], "Smith, J", 8) == 0;
+    cisv_result_free(batch);
+
+    if (rc == 0 && idx_rows == 4 && row3_fields == 2 && batch_ok &&
+        field_count == 7 && row_count == 4 &&
+        strcmp(stored_fields[0], "note") == 0 &&
+        strcmp(stored_fields[1], "id") == 0 &&
+        strcmp(stored_fields[2], "a \"b\"") == 0 &&
+        strcmp(stored_fields[4], "multi\nline") == 0 &&
+        strcmp(stored_fields[6], "3") == 0) {
+        PASS();
+    } else {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "unexpected result: rc=%d rows=%zu fields=%d batch=%d",
+                 rc, idx_rows, field_count, batch_ok);
+        FAIL(buf);
+    }
+}
+
+void test_column_projection(void) {
+    TEST("column projection across parse_file, streaming and iterator");
+    reset_test_state();
+
+    const char *csv = "a,\"skip, me\",c,d\n1,\"x\"\"y\",3,4\n\n5,6\n";
+    const char *path = write_temp_csv(csv);
+    if (!path) { FAIL("failed to create temp file"); return; }
+
+    const int select[] = {3, 0, 3};
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = test_field_cb;
+    config.row_cb = test_row_cb;
+    config.skip_empty_lines = true;
+    config.select_columns = select;
+    config.select_count = 3;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&config);
+    if (!parser) { unlink(path); FAIL("failed to create parser"); return; }
+    int rc = cisv_parser_parse_file(parser, path);
+    int file_ok = rc == 0 && field_count == 5 && row_count == 3 &&
+                  strcmp(stored_fields[0], "a") == 0 &&
+                  strcmp(stored_fields[1], "d") == 0 &&
+                  strcmp(stored_fields[3], "4") == 0 &&
+                  strcmp(stored_fields[4], "5") == 0;
+
+    // Same input fed in small chunks
+    reset_test_state();
+    for (size_t off = 0; off < strlen(csv); off += 5) {
+        size_t n = strlen(csv) - off < 5 ? strlen(csv) - off : 5;
+        cisv_parser_write(parser, (const uint8_t *)csv + off, n);
+    }
+    cisv_parser_end(parser);
+    cisv_parser_destroy(parser);
+    int stream_ok = field_count == 5 && row_count == 3 &&
+                    strcmp(stored_fields[2], "1") == 0 &&
+                    strcmp(stored_fields[3], "4") == 0;
+
+    cisv_iterator_t *it = cisv_iterator_open(path, &config);
+    const char **fields;
+    const size_t *lengths;
+    size_t count;
+    size_t iter_rows = 0;
+    int iter_ok = it != NULL;
+    while (iter_ok && cisv_iterator_next(it, &fields, &lengths, &count) == CISV_ITER_OK) {
+        iter_rows++;
+        if (iter_rows == 2) {
+            iter_ok = count == 2 && lengths[0] == 1 && fields[0][0] == '1' &&
+                      lengths[1] == 1 && fields[1][0] == '4';
+        } else if (iter_rows == 3) {
+            iter_ok = count == 1 && lengths[0] == 1 && fields[0][0] == '5';
+        }
+    }
+    cisv_iterator_close(it);
+    unlink(path);
+
+    if (file_ok && stream_ok && iter_ok && iter_rows == 3) {
+        PASS();
+    } else {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "unexpected result: file=%d stream=%d iter=%d rows=%zu",
+                 file_ok, stream_ok, iter_ok, iter_rows);
+        FAIL(buf);
+    }
+}
+
+void test_pool_morsels_in_file_order(void) {
+    TEST("work-stealing pool keeps morsel results in file order");
+
+    char path[256];
+    snprintf(path, sizeof(path), "/tmp/test_cisv_pool_%d.csv", getpid());
+    FILE *f = fopen(path, "w");
+    if (!f) { FAIL("failed to create temp file"); return; }
+    for (int i = 0; i < 20000; i++) {
+        if (i % 97 == 0) {
+            fprintf(f, "%d,\"multi\nline, %d\",x\n", i, i);
+        } else {
+            fprintf(f, "%d,value_%d,x\n", i, i);
+        }
+    }
+    fclose(f);
+
+    cisv_pool_t *pool = cisv_pool_create(3);
+    if (!pool) { unlink(path); FAIL("failed to create pool"); return; }
+
+    int ok = cisv_pool_size(pool) == 3;
+    for (int pass = 0; pass < 2 && ok; pass++) {
+        int result_count = 0;
+        cisv_result_t **results = cisv_pool_parse_file(pool, path, NULL, 8192, &result_count);
+        if (!results || result_count < 10) {
+            ok = 0;
+            cisv_results_free(results, result_count);
+            break;
+        }
+
+        long expected = 0;
+        for (int i = 0; i < result_count && ok; i++) {
+            cisv_result_t *r = results[i];
+            if (!r || r->error_code != 0) { ok = 0; break; }
+            for (size_t row = 0; row < r->row_count; row++) {
+                if (r->rows[row].field_count != 3 ||
+                    strtol(r->rows[row].fields[0], NULL, 10) != expected) {
+                    ok = 0;
+                    break;
+                }
+                expected++;
+            }
+        }
+        ok = ok && expected == 20000;
+        cisv_results_free(results, result_count);
+    }
+
+    cisv_pool_destroy(pool);
+    unlink(path);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("rows missing or out of order");
+    }
+}
+
+void test_split_chunks_quote_parity(void) {
+    TEST("chunk splitter respects quote parity and counts rows");
+
+    char path[256];
+    snprintf(path, sizeof(path), "/tmp/test_cisv_split_%d.csv", getpid());
+    FILE *f = fopen(path, "w");
+    if (!f) { FAIL("failed to create temp file"); return; }
+    // Long quoted fields full of newlines make raw range starts land inside quotes
+    for (int i = 0; i < 3000; i++) {
+        if (i % 5 == 0) {
+            fprintf(f, "%d,\"", i);
+            for (int k = 0; k < 40; k++) fprintf(f, "l%d\n\"\"", k);
+            fprintf(f, "\"\n");
+        } else {
+            fprintf(f, "%d,plain\n", i);
+        }
+    }
+    fclose(f);
+
+    cisv_mmap_file_t *file = cisv_mmap_open(path);
+    if (!file) { unlink(path); FAIL("failed to map file"); return; }
+
+    int ok = 1;
+    for (int n = 2; n <= 16 && ok; n += 7) {
+        int chunk_count = 0;
+        cisv_chunk_t *chunks = cisv_split_chunks(file, n, &chunk_count);
+        if (!chunks || chunk_count < 2) { ok = 0; free(chunks); break; }
+
+        size_t rows = 0;
+        for (int i = 0; i < chunk_count; i++) {
+            rows += chunks[i].row_count;
+            // Every chunk must start a record: "<id>,"
+            if (chunks[i].start[0] < '0' || chunks[i].start[0] > '9') ok = 0;
+            if (i > 0 && chunks[i].start != chunks[i - 1].end) ok = 0;
+        }
+        if (rows != 3000 || chunks[chunk_count - 1].end != file->data + file->size) ok = 0;
+        free(chunks);
+    }
+
+    cisv_mmap_close(file);
+    unlink(path);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("chunk boundaries or row counts are wrong");
+    }
+}
+
+void test_pool_speculative_matches_serial(void) {
+    TEST("speculative morsel parse matches a serial parse");
+
+    char path[256];
+    snprintf(path, sizeof(path), "/tmp/test_cisv_spec_%d.csv", getpid());
+    FILE *f = fopen(path, "w");
+    if (!f) { FAIL("failed to create temp file"); return; }
+    // Multi-line JSON payloads, comment lines and CRLF rows in one file
+    for (int i = 0; i < 4000; i++) {
+        if (i % 50 == 0) {
+            fprintf(f, "# section %d, \"quoted\" note\n", i);
+        } else if (i % 7 == 0) {
+            fprintf(f, "%d,\"{\n  \"\"id\"\": %d,\n  \"\"tags\"\": [\"\"a,b\"\"]\n}\"\r\n", i, i);
+        } else {
+            fprintf(f, "%d,row_%d\n", i, i);
+        }
+    }
+    fclose(f);
+
+    cisv_config config;
+    cisv_config_init(&config);
+    config.comment = '#';
+
+    cisv_result_t *serial = cisv_parse_file_batch(path, &config);
+    cisv_pool_t *pool = cisv_pool_create(4);
+    int ok = serial && pool;
+
+    for (size_t morsel = 4096; morsel <= 65536 && ok; morsel *= 4) {
+        int result_count = 0;
+        cisv_result_t **results = cisv_pool_parse_file(pool, path, &config, morsel, &result_count);
+        if (!results || result_count < 2) {
+            ok = 0;
+            cisv_results_free(results, result_count);
+            break;
+        }
+
+        size_t row = 0;
+        for (int i = 0; i < result_count && ok; i++) {
+            cisv_result_t *r = results[i];
+            if (!r || r->error_code != 0) { ok = 0; break; }
+            for (size_t k = 0; k < r->row_count && ok; k++, row++) {
+                if (row >= serial->row_count ||
+                    r->rows[k].field_count != serial->rows[row].field_count) {
+                    ok = 0;
+                    break;
+                }
+                for (size_t c = 0; c < r->rows[k].field_count; c++) {
+                    if (r->rows[k].field_lengths[c] != serial->rows[row].field_lengths[c] ||
+                        memcmp(r->rows[k].fields[c], serial->rows[row].fields[c],
+                               r->rows[k].field_lengths[c]) != 0) {
+                        ok = 0;
+                        break;
+                    }
+                }
+            }
+        }
+        ok = ok && row == serial->row_count;
+        cisv_results_free(results, result_count);
+    }
+
+    if (pool) cisv_pool_destroy(pool);
+    cisv_result_free(serial);
+    unlink(path);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("parallel rows differ from serial parse");
+    }
+}
+
+typedef struct {
+    long next_id;                // Expected first field of the next row
+    int fields;                  // Fields seen in the current row
+    int ok;
+    int batches;
+} stream_order_state;
+
+static void stream_order_field_cb(void *user, const char *data, size_t len) {
+    stream_order_state *st = (stream_order_state *)user;
+    if (st->fields++ == 0) {
+        char buf[32];
+        if (len >= sizeof(buf)) len = sizeof(buf) - 1;
+        memcpy(buf, data, len);
+        buf[len] = '\0';
+        if (strtol(buf, NULL, 10) != st->next_id) st->ok = 0;
+    }
+}
+
+static void stream_order_row_cb(void *user) {
+    stream_order_state *st = (stream_order_state *)user;
+    if (st->fields != 3) st->ok = 0;
+    st->fields = 0;
+    st->next_id++;
+}
+
+// Starts a parse of the same file on the same pool from inside a callback
+typedef struct {
+    cisv_pool_t *pool;
+    const char *path;
+    size_t nested_rows;
+} stream_nested_state;
+
+static int stream_nested_batch_cb(void *user, const cisv_result_t *batch) {
+    stream_nested_state *st = (stream_nested_state *)user;
+    (void)batch;
+    if (st->nested_rows > 0) return 0;
+    int count = 0;
+    cisv_result_t **results = cisv_pool_parse_file(st->pool, st->path, NULL, 4096, &count);
+    for (int i = 0; results && i < count; i++) {
+        st->nested_rows += results[i]->row_count;
+    }
+    cisv_results_free(results, count);
+    return 0;
+}
+
+static int stream_stop_batch_cb(void *user, const cisv_result_t *batch) {
+    stream_order_state *st = (stream_order_state *)user;
+    st->next_id += (long)batch->row_count;
+    return ++st->batches == 3;
+}
+
+void test_pool_stream_in_order(void) {
+    TEST("ordered parallel stream delivers rows in file order");
+
+    char path[256];
+    snprintf(path, sizeof(path), "/tmp/test_cisv_stream_%d.csv", getpid());
+    FILE *f = fopen(path, "w");
+    if (!f) { FAIL("failed to create temp file"); return; }
+    for (int i = 0; i < 30000; i++) {
+        if (i % 11 == 0) {
+            fprintf(f, "%d,\"wrapped\n%d\",x\n", i, i);
+        } else {
+            fprintf(f, "%d,value_%d,x\n", i, i);
+        }
+    }
+    fclose(f);
+
+    cisv_pool_t *pool = cisv_pool_create(3);
+    if (!pool) { unlink(path); FAIL("failed to create pool"); return; }
+
+    stream_order_state st = { .ok = 1 };
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = stream_order_field_cb;
+    config.row_cb = stream_order_row_cb;
+    config.user = &st;
+
+    // Tiny morsels and a two-morsel window force many window hand-offs
+    int rc = cisv_pool_stream_file(pool, path, &config, 4096, 2, NULL);
+    int ok = rc == 0 && st.ok && st.next_id == 30000;
+
+    // A batch consumer can stop the stream early
+    stream_order_state stop = { .ok = 1 };
+    config.user = &stop;
+    rc = cisv_pool_stream_file(pool, path, &config, 4096, 2, stream_stop_batch_cb);
+    ok = ok && rc == 0 && stop.batches == 3 && stop.next_id > 0 && stop.next_id < 30000;
+
+    // Re-entering the pool from a callback while a window is in flight
+    stream_nested_state nested = { .pool = pool, .path = path };
+    config.user = &nested;
+    rc = cisv_pool_stream_file(pool, path, &config, 4096, 2, stream_nested_batch_cb);
+    ok = ok && rc == 0 && nested.nested_rows == 30000;
+
+    cisv_pool_destroy(pool);
+    unlink(path);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("rows missing, out of order, stream did not stop or nested parse failed");
+    }
+}
+
+void test_columnar_result(void) {
+    TEST("columnar result stores Arrow-style offsets and validity");
+
+    const char *csv = "id,name,note\n1,\"Smith, J\",\n2,Lee\n3,\"multi\nline\",x,extra\n";
+    cisv_columnar_t *r = cisv_parse_string_columnar(csv, strlen(csv), NULL);
+    if (!r) { FAIL("columnar parse returned NULL"); return; }
+
+    int ok = r->error_code == 0 && r->row_count == 4 && r->column_count == 4;
+    for (size_t i = 0; ok && i < r->column_count; i++) {
+        ok = r->columns[i].length == r->row_count && r->columns[i].offset_width == 4;
+    }
+
+    size_t len = 0;
+    const char *v;
+    if (ok) {
+        const cisv_column_t *name = &r->columns[1];
+        v = cisv_column_value(name, 1, &len);
+        ok = v && len == 8 && memcmp(v, "Smith, J", 8) == 0;
+        v = cisv_column_value(name, 3, &len);
+        ok = ok && v && len == 10 && memcmp(v, "multi\nline", 10) == 0;
+        // Values are contiguous: offsets are running sums of field lengths
+        ok = ok && name->offsets[0] == 0 && name->offsets[4] == (int32_t)name->values_size;
+    }
+    if (ok) {
+        // Present-but-empty field vs missing field
+        const cisv_column_t *note = &r->columns[2];
+        v = cisv_column_value(note, 1, &len);
+        ok = v && len == 0 && note->null_count == 1 && !cisv_column_value(note, 2, &len);
+        const cisv_column_t *extra = &r->columns[3];
+        ok = ok && extra->null_count == 3 && extra->validity && extra->validity[0] == 0x08;
+        v = cisv_column_value(extra, 3, &len);
+        ok = ok && v && len == 5 && memcmp(v, "extra", 5) == 0;
+        ok = ok && r->columns[0].validity == NULL && r->columns[0].null_count == 0;
+    }
+    cisv_columnar_free(r);
+
+    // A column whose fields are all present but empty
+    if (ok) {
+        const char *blank = "a,\nb,\n";
+        r = cisv_parse_string_columnar(blank, strlen(blank), NULL);
+        ok = r && r->column_count == 2 && r->columns[1].null_count == 0;
+        v = ok ? cisv_column_value(&r->columns[1], 0, &len) : NULL;
+        ok = ok && v && len == 0;
+        cisv_columnar_free(r);
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("columnar buffers do not match the input");
+    }
+}
+
+void test_arrow_export(void) {
+    TEST("Arrow C Data Interface export moves columnar buffers");
+
+    const char *csv = "id,name\n1,alpha\n2,\"be,ta\"\n3\n";
+    cisv_columnar_t *r = cisv_parse_string_columnar(csv, strlen(csv), NULL);
+    if (!r) { FAIL("columnar parse returned NULL"); return; }
+
+    const char *values = r->columns[1].values;
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    if (cisv_columnar_export_arrow(r, true, &schema, &array) != 0) {
+        cisv_columnar_free(r);
+        FAIL("export failed");
+        return;
+    }
+
+    int ok = strcmp(schema.format, "+s") == 0 && schema.n_children == 2 &&
+             array.length == 3 && array.n_children == 2;
+    if (ok) {
+        struct ArrowSchema *name_field = schema.children[1];
+        struct ArrowArray *names = array.children[1];
+        const int32_t *offsets = (const int32_t *)names->buffers[1];
+        const char *data = (const char *)names->buffers[2];
+        ok = strcmp(name_field->format, "u") == 0 && strcmp(name_field->name, "name") == 0 &&
+             strcmp(schema.children[0]->name, "id") == 0 &&
+             data == values &&                           // moved, not copied
+             names->offset == 1 && names->length == 3 && names->null_count == 1 &&
+             offsets[2] - offsets[1] == 5 && memcmp(data + offsets[1], "alpha", 5) == 0 &&
+             offsets[3] - offsets[2] == 5 && memcmp(data + offsets[2], "be,ta", 5) == 0;
+
+        // Consumers may move a child out and release it on its own
+        struct ArrowArray moved = *names;
+        names->release = NULL;
+        moved.release(&moved);
+        ok = ok && moved.release == NULL;
+    }
+
+    array.release(&array);
+    schema.release(&schema);
+    ok = ok && array.release == NULL && schema.release == NULL;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("exported Arrow structures are wrong");
+    }
+}
+
+static void count_error_cb(void *user, int line, const char *msg) {
+    (void)line;
+    (void)msg;
+    (*(int *)user)++;
+}
+
+void test_arrow_file_errors(void) {
+    TEST("Arrow file export keeps rows on recoverable parse errors");
+
+    const char *path = write_temp_csv("a,b\n1,\"open\n");
+    int errors = 0;
+    cisv_config config;
+    cisv_config_init(&config);
+    config.error_cb = count_error_cb;
+    config.user = &errors;
+
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    int rc = cisv_parse_file_arrow(path, &config, false, &schema, &array);
+    int ok = rc == 0 && errors == 1 && array.length == 2;
+    if (rc == 0) {
+        array.release(&array);
+        schema.release(&schema);
+    }
+    unlink(path);
+
+    errno = 0;
+    ok = ok && cisv_parse_file_arrow("/nonexistent/cisv.csv", &config, false,
+                                     &schema, &array) < 0 && errno == ENOENT;
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("recoverable errors must export, I/O errors must keep errno");
+    }
+}
+
+void test_typed_columns(void) {
+    TEST("typed column inference parses native values");
+
+    // Column "late" turns non-numeric after the 2-row sample, "price"
+    // switches from integers to decimals
+    const char *csv =
+        "id,price,ok,day,zip,late\n"
+        "1,10,true,2024-02-29,01234,5\n"
+        "2,,FALSE,1970-01-01,99999,6\n"
+        "-3,2.5e1,false,1969-12-31,00001,n/a\n";
+    cisv_columnar_t *r = cisv_parse_string_typed(csv, strlen(csv), NULL, true, 2);
+    if (!r) { FAIL("typed parse returned NULL"); return; }
+
+    int ok = r->error_code == 0 && r->row_count == 3 && r->column_count == 6 &&
+             r->name_count == 6 && strcmp(r->names[3], "day") == 0;
+    if (ok) {
+        const cisv_column_t *c = r->columns;
+        const int64_t *ids = (const int64_t *)c[0].data;
+        const double *prices = (const double *)c[1].data;
+        const uint8_t *flags = (const uint8_t *)c[2].data;
+        const int32_t *days = (const int32_t *)c[3].data;
+        size_t len = 0;
+        const char *late = cisv_column_value(&c[5], 2, &len);
+
+        ok = c[0].type == CISV_TYPE_INT64 && ids[0] == 1 && ids[2] == -3 &&
+             c[1].type == CISV_TYPE_FLOAT64 && prices[0] == 10.0 && prices[2] == 25.0 &&
+             !cisv_column_is_valid(&c[1], 1) && c[1].null_count == 1 &&
+             c[2].type == CISV_TYPE_BOOL && flags[0] == 0x01 &&
+             c[3].type == CISV_TYPE_DATE && days[0] == 19782 && days[1] == 0 && days[2] == -1 &&
+             c[4].type == CISV_TYPE_STRING &&
+             c[5].type == CISV_TYPE_STRING && late && len == 3 && memcmp(late, "n/a", 3) == 0;
+    }
+    cisv_columnar_free(r);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("inferred types or values are wrong");
+    }
+}
+
+void test_typed_float_precision(void) {
+    TEST("typed columns never round integers beyond 2^53 into float64");
+
+    // "edge" widens at exactly 2^53, "big" holds 2^53 + 1 and must not;
+    // "late" is inferred float64 and then meets 2^53 + 1
+    const char *csv =
+        "edge,big,late\n"
+        "1,1,0.5\n"
+        "9007199254740992,9007199254740993,1.5\n"
+        "-9007199254740992,2,9007199254740993\n"
+        "0.5,0.5,2.5\n";
+    cisv_columnar_t *r = cisv_parse_string_typed(csv, strlen(csv), NULL, true, 1);
+    if (!r) { FAIL("typed parse returned NULL"); return; }
+
+    int ok = r->error_code == 0 && r->row_count == 4 && r->column_count == 3;
+    if (ok) {
+        const cisv_column_t *c = r->columns;
+        const double *edge = (const double *)c[0].data;
+        size_t big_len = 0, late_len = 0;
+        const char *big = cisv_column_value(&c[1], 1, &big_len);
+        const char *late = cisv_column_value(&c[2], 2, &late_len);
+
+        ok = c[0].type == CISV_TYPE_FLOAT64 && edge[1] == 9007199254740992.0 &&
+             edge[2] == -9007199254740992.0 && edge[3] == 0.5 &&
+             c[1].type == CISV_TYPE_STRING && big && big_len == 16 &&
+             memcmp(big, "9007199254740993", 16) == 0 &&
+             c[2].type == CISV_TYPE_STRING && late && late_len == 16 &&
+             memcmp(late, "9007199254740993", 16) == 0;
+    }
+    cisv_columnar_free(r);
+
+    // Sampled together, 2^53 + 1 and a decimal leave no exact numeric type
+    const char *mixed = "v\n9007199254740993\n0.5\n";
+    r = cisv_parse_string_typed(mixed, strlen(mixed), NULL, true, 0);
+    ok = ok && r && r->columns[0].type == CISV_TYPE_STRING;
+    cisv_columnar_free(r);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("integers beyond 2^53 were rounded into float64");
+    }
+}
+
+void test_dictionary_columns(void) {
+    TEST("repetitive typed columns are dictionary-encoded on request");
+
+    // "color" repeats three values throughout; "city" repeats in the
+    // sample, then turns unique and outgrows the dictionary
+    size_t rows = 6000;
+    char *csv = malloc(rows * 48 + 32);
+    if (!csv) { FAIL("malloc failed"); return; }
+    static const char *colors[] = {"red", "green", "blue"};
+    size_t pos = (size_t)sprintf(csv, "id,color,city\n");
+    for (size_t i = 0; i < rows; i++) {
+        if (i < 1000) {
+            pos += (size_t)sprintf(csv + pos, "%zu,%s,town%zu\n", i, colors[i % 3], i % 10);
+        } else {
+            pos += (size_t)sprintf(csv + pos, "%zu,%s,city%zu\n", i, i == 4000 ? "" : colors[i % 3], i);
+        }
+    }
+
+    // Off by default: every string column stays CISV_TYPE_STRING
+    cisv_columnar_t *r = cisv_parse_string_typed(csv, pos, NULL, true, 0);
+    int plain = r && r->error_code == 0 && r->column_count == 3 &&
+                r->columns[1].type == CISV_TYPE_STRING && r->columns[1].dict_size == 0 &&
+                r->columns[2].type == CISV_TYPE_STRING;
+    cisv_columnar_free(r);
+
+    cisv_config config;
+    cisv_config_init(&config);
+    config.dictionary_encode = true;
+    r = cisv_parse_string_typed(csv, pos, &config, true, 0);
+    free(csv);
+    if (!plain) { FAIL("string columns were dictionary-encoded by default"); cisv_columnar_free(r); return; }
+    if (!r) { FAIL("typed parse returned NULL"); return; }
+
+    int ok = r->error_code == 0 && r->row_count == rows && r->column_count == 3;
+    if (ok) {
+        const cisv_column_t *color = &r->columns[1];
+        const cisv_column_t *city = &r->columns[2];
+        const uint32_t *codes = (const uint32_t *)color->data;
+        size_t len = 0;
+        const char *v = cisv_column_value(color, 5, &len);
+        ok = color->type == CISV_TYPE_DICT && color->dict_size == 4 &&
+             codes[0] == codes[3] && codes[0] != codes[1] &&
+             v && len == 4 && memcmp(v, "blue", 4) == 0 &&
+             color->values_size == strlen("redgreenblue");
+        v = cisv_column_value(color, 4000, &len);
+        ok = ok && v && len == 0;
+
+        v = cisv_column_value(city, 7, &len);
+        ok = ok && city->type == CISV_TYPE_STRING && city->dict_size == 0 &&
+             v && len == 5 && memcmp(v, "town7", 5) == 0;
+        v = cisv_column_value(city, rows - 1, &len);
+        ok = ok && v && len == 8 && memcmp(v, "city5999", 8) == 0;
+    }
+
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    if (ok && cisv_columnar_export_arrow(r, false, &schema, &array) == 0) {
+        struct ArrowSchema *field = schema.children[1];
+        struct ArrowArray *child = array.children[1];
+        ok = strcmp(field->format, "I") == 0 && field->dictionary &&
+             strcmp(field->dictionary->format, "u") == 0 &&
+             child->n_buffers == 2 && child->length == (int64_t)rows &&
+             child->dictionary && child->dictionary->length == 4 &&
+             strcmp(schema.children[2]->format, "u") == 0 && !schema.children[2]->dictionary;
+        if (ok) {
+            const uint32_t *codes = (const uint32_t *)child->buffers[1];
+            const int32_t *offsets = (const int32_t *)child->dictionary->buffers[1];
+            const char *data = (const char *)child->dictionary->buffers[2];
+            ok = offsets[codes[1] + 1] - offsets[codes[1]] == 5 &&
+                 memcmp(data + offsets[codes[1]], "green", 5) == 0;
+        }
+        array.release(&array);
+        schema.release(&schema);
+        ok = ok && array.release == NULL && schema.release == NULL;
+    } else {
+        cisv_columnar_free(r);
+        ok = 0;
+    }
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("dictionary columns are wrong");
+    }
+}
+
+void test_iterator_batch_spans(void) {
+    TEST("iterator spans and batches match expected rows");
+
+    char long_field[71];
+    memset(long_field, 'x', 70);
+    long_field[70] = '\0';
+
+    char csv[512];
+    snprintf(csv, sizeof(csv),
+             "id,text\r\n"
+             "1,\"a \"\"quoted\"\" word, with comma\"\r\n"
+             "2,%s\n"
+             "\n"
+             "3,\"line\nbreak\"\"\"\n"
+             "4,last", long_field);
+    const char *path = write_temp_csv(csv);
+    if (!path) { FAIL("failed to create temp file"); return; }
+
+    const char *expected[5][2] = {
+        {"id", "text"},
+        {"1", "a \"quoted\" word, with comma"},
+        {"2", long_field},
+        {"3", "line\nbreak\""},
+        {"4", "last"},
+    };
+
+    cisv_config config;
+    cisv_config_init(&config);
+    config.skip_empty_lines = true;
+
+    // Row at a time
+    cisv_iterator_t *it = cisv_iterator_open(path, &config);
+    const char **fields;
+    const size_t *lengths;
+    size_t count;
+    size_t rows = 0;
+    int next_ok = it != NULL;
+    while (next_ok && cisv_iterator_next(it, &fields, &lengths, &count) == CISV_ITER_OK) {
+        next_ok = rows < 5 && count == 2;
+        for (size_t i = 0; next_ok && i < 2; i++) {
+            next_ok = lengths[i] == strlen(expected[rows][i]) &&
+                      memcmp(fields[i], expected[rows][i], lengths[i]) == 0;
+        }
+        rows++;
+    }
+    next_ok = next_ok && rows == 5;
+    cisv_iterator_close(it);
+
+    // Two rows per batch
+    it = cisv_iterator_open(path, &config);
+    cisv_iterator_batch_t batch;
+    size_t batch_rows = 0, batches = 0;
+    int batch_ok = it != NULL;
+    while (batch_ok && cisv_iterator_next_batch(it, 2, &batch) == CISV_ITER_OK) {
+        batches++;
+        batch_ok = batch.row_count >= 1 && batch.row_count <= 2 &&
+                   batch.row_offsets[batch.row_count] == batch.field_count;
+        for (size_t r = 0; batch_ok && r < batch.row_count; r++, batch_rows++) {
+            size_t first = batch.row_offsets[r];
+            batch_ok = batch_rows < 5 && batch.row_offsets[r + 1] - first == 2;
+            for (size_t i = 0; batch_ok && i < 2; i++) {
+                const char *want = expected[batch_rows][i];
+                batch_ok = batch.lengths[first + i] == strlen(want) &&
+                           memcmp(batch.fields[first + i], want, strlen(want)) == 0;
+            }
+        }
+    }
+    batch_ok = batch_ok && batch_rows == 5 && batches == 3 &&
+               cisv_iterator_next_batch(it, 2, &batch) == CISV_ITER_EOF && batch.row_count == 0;
+    cisv_iterator_close(it);
+
+    // Escaped quotes are unescaped into the iterator buffer, never in the file
+    char disk[512] = {0};
+    FILE *f = fopen(path, "r");
+    size_t disk_len = f ? fread(disk, 1, sizeof(disk) - 1, f) : 0;
+    if (f) fclose(f);
+    int file_ok = disk_len == strlen(csv) && memcmp(disk, csv, disk_len) == 0;
+    unlink(path);
+
+    if (next_ok && batch_ok && file_ok) {
+        PASS();
+    } else {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "next=%d batch=%d file=%d rows=%zu batch_rows=%zu",
+                 next_ok, batch_ok, file_ok, rows, batch_rows);
+        FAIL(buf);
+    }
+}
+
+typedef struct {
+    uint64_t hash;
+    size_t fields;
+    size_t rows;
+} read_digest_t;
+
+static void read_digest_field(void *user, const char *data, size_t len) {
+    read_digest_t *d = user;
+    for (size_t i = 0; i < len; i++) {
+        d->hash = (d->hash ^ (uint8_t)data[i]) * 1099511628211ULL;
+    }
+    d->hash = (d->hash ^ 0x100) * 1099511628211ULL;
+    d->fields++;
+}
+
+static void read_digest_row(void *user) {
+    read_digest_t *d = user;
+    d->hash = (d->hash ^ 0x200) * 1099511628211ULL;
+    d->rows++;
+}
+
+static int parse_digest(read_digest_t *d, const char *path, int fd,
+                        const cisv_read_config *rc) {
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = read_digest_field;
+    config.row_cb = read_digest_row;
+    config.user = d;
+    d->hash = 14695981039346656037ULL;
+    d->fields = 0;
+    d->rows = 0;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&config);
+    if (!parser) return -1;
+    int rc_parse = fd >= 0 ? cisv_parser_parse_fd(parser, fd, rc)
+                 : rc ? cisv_parser_parse_file_read(parser, path, rc)
+                      : cisv_parser_parse_file(parser, path);
+    cisv_parser_destroy(parser);
+    return rc_parse;
+}
+
+void test_read_pipeline(void) {
+    TEST("read pipeline matches mmap parse (io_uring, pread, pipe)");
+
+    // ~30KB with quoted commas, escaped quotes and embedded newlines so
+    // fields straddle the 4 KiB read buffers; stays under the pipe capacity
+    size_t cap = 32 * 1024, len = 0;
+    char *csv = malloc(cap);
+    if (!csv) { FAIL("alloc failed"); return; }
+    for (int i = 0; len + 64 < cap - 1; i++) {
+        len += (size_t)snprintf(csv + len, cap - len,
+                                i % 7 == 0 ? "%d,\"multi\nline, \"\"%d\"\"\",x\r\n"
+                                           : "%d,plain value %d,y\n", i, i * 31);
+    }
+    csv[len] = '\0';
+    const char *path = write_temp_csv(csv);
+    if (!path) { free(csv); FAIL("failed to create temp file"); return; }
+
+    read_digest_t ref, uring, sync, piped;
+    int ok = parse_digest(&ref, path, -1, NULL) == 0 && ref.rows > 0;
+
+    cisv_read_config rc;
+    cisv_read_config_init(&rc);
+    rc.buffer_size = 4096;
+    rc.queue_depth = 3;
+    rc.direct = true;
+    ok = ok && parse_digest(&uring, path, -1, &rc) == 0;
+
+    rc.use_io_uring = false;
+    ok = ok && parse_digest(&sync, path, -1, &rc) == 0;
+
+    // A pipe cannot be mmapped; parse_fd reads it until EOF
+    int pipefd[2];
+    ok = ok && pipe(pipefd) == 0;
+    if (ok) {
+        ok = write(pipefd[1], csv, len) == (ssize_t)len;
+        close(pipefd[1]);
+        rc.use_io_uring = true;
+        ok = ok && parse_digest(&piped, NULL, pipefd[0], &rc) == 0;
+        close(pipefd[0]);
+    }
+    unlink(path);
+    free(csv);
+
+    ok = ok && uring.hash == ref.hash && uring.rows == ref.rows &&
+         sync.hash == ref.hash && sync.rows == ref.rows &&
+         piped.hash == ref.hash && piped.rows == ref.rows && piped.fields == ref.fields;
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("read pipeline result differs from mmap parse");
+    }
+}
+
+static int window_digest(read_digest_t *d, const char *path, size_t window, bool iterate) {
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = read_digest_field;
+    config.row_cb = read_digest_row;
+    config.user = d;
+    config.mmap_window = window;
+    d->hash = 14695981039346656037ULL;
+    d->fields = 0;
+    d->rows = 0;
+
+    if (!iterate) {
+        cisv_parser *parser = cisv_parser_create_with_config(&config);
+        if (!parser) return -1;
+        int rc = cisv_parser_parse_file(parser, path);
+        cisv_parser_destroy(parser);
+        return rc;
+    }
+
+    cisv_iterator_t *it = cisv_iterator_open(path, &config);
+    if (!it) return -1;
+    const char **fields;
+    const size_t *lengths;
+    size_t count;
+    int rc;
+    while ((rc = cisv_iterator_next(it, &fields, &lengths, &count)) == CISV_ITER_OK) {
+        for (size_t i = 0; i < count; i++) read_digest_field(d, fields[i], lengths[i]);
+        read_digest_row(d);
+    }
+    cisv_iterator_close(it);
+    return rc == CISV_ITER_EOF ? 0 : -1;
+}
+
+void test_mmap_window(void) {
+    TEST("windowed mmap matches whole-file mapping");
+
+    // Rows of varying width with escaped quotes and CRLF endings, so window
+    // and chunk boundaries land inside quoted fields, "" pairs and \r\n
+    size_t cap = 48 * 1024, len = 0;
+    char *csv = malloc(cap);
+    if (!csv) { FAIL("alloc failed"); return; }
+    for (int i = 0; len + 128 < cap - 1; i++) {
+        len += (size_t)snprintf(csv + len, cap - len,
+                                i % 3 == 0 ? "%d,\"a \"\"quoted\"\"\nvalue %d\",\"\"\"\"\r\n"
+                                           : "%d,plain %d,%.*s\r\n",
+                                i, i * 17, i % 41, "ppppppppppppppppppppppppppppppppppppppppp");
+    }
+    csv[len] = '\0';
+    const char *path = write_temp_csv(csv);
+    free(csv);
+    if (!path) { FAIL("failed to create temp file"); return; }
+
+    read_digest_t whole, windowed, it_whole, it_windowed;
+    int ok = window_digest(&whole, path, SIZE_MAX, false) == 0 && whole.rows > 0 &&
+             window_digest(&windowed, path, 4096, false) == 0 &&
+             window_digest(&it_whole, path, SIZE_MAX, true) == 0 &&
+             window_digest(&it_windowed, path, 4096, true) == 0;
+    unlink(path);
+
+    ok = ok && windowed.hash == whole.hash && windowed.rows == whole.rows &&
+         it_whole.hash == whole.hash && it_windowed.hash == whole.hash &&
+         it_windowed.rows == whole.rows;
+    if (ok) {
+        PASS();
+    } else {
+        FAIL("windowed result differs from whole-file mapping");
+    }
+}
+
+static int strategy_digest(read_digest_t *d, const char *path, cisv_io_strategy strategy,
+                           size_t window, cisv_io_strategy *used) {
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = read_digest_field;
+    config.row_cb = read_digest_row;
+    config.user = d;
+    config.io_strategy = strategy;
+    config.mmap_window = window;
+    d->hash = 14695981039346656037ULL;
+    d->fields = 0;
+    d->rows = 0;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&config);
+    if (!parser) return -1;
+    int rc = cisv_parser_parse_file(parser, path);
+    *used = cisv_parser_io_strategy(parser);
+    cisv_parser_destroy(parser);
+    return rc;
+}
+
+void test_io_strategy(void) {
+    TEST("every I/O strategy parses identically and is reported");
+
+    // ~5 MB: past the small-file limit so AUTO picks a mapping, and past
+    // one 2 MiB huge-page read buffer
+    size_t cap = 5 * 1024 * 1024, len = 0;
+    char *csv = malloc(cap);
+    if (!csv) { FAIL("alloc failed"); return; }
+    for (int i = 0; len + 128 < cap - 1; i++) {
+        len += (size_t)snprintf(csv + len, cap - len,
+                                i % 5 == 0 ? "%d,\"q \"\"%d\"\"\nx\",end\r\n" : "%d,v%d,end\n",
+                                i, i * 7);
+    }
+    csv[len] = '\0';
+    const char *path = write_temp_csv(csv);
+    free(csv);
+    if (!path) { FAIL("failed to create temp file"); return; }
+
+    static const cisv_io_strategy strategies[] = {
+        CISV_IO_MMAP, CISV_IO_MMAP_LAZY, CISV_IO_PREAD, CISV_IO_DIRECT, CISV_IO_AUTO
+    };
+    read_digest_t ref, d;
+    cisv_io_strategy used;
+    int ok = strategy_digest(&ref, path, CISV_IO_MMAP, 0, &used) == 0 && ref.rows > 0;
+    char buf[128] = "parse failed";
+    for (size_t i = 0; ok && i < sizeof(strategies) / sizeof(strategies[0]); i++) {
+        ok = strategy_digest(&d, path, strategies[i], 64 * 1024, &used) == 0 &&
+             d.hash == ref.hash && d.rows == ref.rows;
+        // O_DIRECT falls back to buffered reads where unsupported (tmpfs)
+        bool reported = strategies[i] == CISV_IO_AUTO ? used != CISV_IO_AUTO
+                      : strategies[i] == CISV_IO_DIRECT ? used == CISV_IO_DIRECT || used == CISV_IO_PREAD
+                      : used == strategies[i];
+        if (ok && !reported) {
+            snprintf(buf, sizeof(buf), "requested %s, reported %s",
+                     cisv_io_strategy_name(strategies[i]), cisv_io_strategy_name(used));
+            ok = 0;
+        } else if (!ok) {
+            snprintf(buf, sizeof(buf), "%s result differs", cisv_io_strategy_name(strategies[i]));
+        }
+    }
+    unlink(path);
+
+    if (ok) {
+        PASS();
+    } else {
+        FAIL(buf);
+    }
+}
+
+static uint32_t test_crc32(const uint8_t *data, size_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static void put_le(FILE *f, uint32_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) fputc((int)(v >> (8 * i)) & 0xFF, f);
+}
+
+// One BGZF member holding data in a single stored (uncompressed) deflate
+// block, so the test needs no codec of its own
+static void write_bgzf_member(FILE *f, const uint8_t *data, size_t len) {
+    static const uint8_t header[] = { 0x1f, 0x8b, 8, 4, 0, 0, 0, 0, 0, 0xff, 6, 0, 'B', 'C', 2, 0 };
+    fwrite(header, 1, sizeof(header), f);
+    put_le(f, (uint32_t)(sizeof(header) + 2 + 5 + len + 8 - 1), 2);
+    fputc(1, f);  // BFINAL, stored
+    put_le(f, (uint32_t)len, 2);
+    put_le(f, (uint32_t)(~len & 0xFFFF), 2);
+    fwrite(data, 1, len, f);
+    put_le(f, test_crc32(data, len), 4);
+    put_le(f, (uint32_t)len, 4);
+}
+
+static int compressed_digest(read_digest_t *d, const char *path, int threads) {
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = read_digest_field;
+    config.row_cb = read_digest_row;
+    config.user = d;
+    d->hash = 14695981039346656037ULL;
+    d->fields = 0;
+    d->rows = 0;
+
+    cisv_parser *parser = cisv_parser_create_with_config(&config);
+    if (!parser) return -1;
+    int rc = cisv_parser_parse_compressed(parser, path, threads);
+    cisv_parser_destroy(parser);
+    return rc;
+}
+
+void test_compressed_input(void) {
+    TEST("gzip input (BGZF parallel and streaming) matches plain parse");
+
+    static const uint8_t zstd_magic[] = { 0x28, 0xb5, 0x2f, 0xfd };
+    int ok = cisv_detect_compression((const uint8_t *)"\x1f\x8b\x08", 3) == CISV_COMPRESSION_GZIP &&
+             cisv_detect_compression(zstd_magic, 4) == CISV_COMPRESSION_ZSTD &&
+             cisv_detect_compression((const uint8_t *)"a,b\n", 4) == CISV_COMPRESSION_NONE;
+
+    // ~3 MB so the blocks form several parallel units
+    size_t cap = 3 * 1024 * 1024, len = 0;
+    char *csv = malloc(cap);
+    if (!csv) { FAIL("alloc failed"); return; }
+    for (int i = 0; len + 128 < cap - 1; i++) {
+        len += (size_t)snprintf(csv + len, cap - len,
+                                i % 4 == 0 ? "%d,\"gz \"\"%d\"\"\nrow\",z\r\n" : "%d,plain %d,z\n",
+                                i, i * 3);
+    }
+    csv[len] = '\0';
+    const char *plain = write_temp_csv(csv);
+    char gz[256], bad[256];
+    snprintf(gz, sizeof(gz), "%s.gz", plain ? plain : "/tmp/test_cisv_core");
+    snprintf(bad, sizeof(bad), "%s.bad.gz", plain ? plain : "/tmp/test_cisv_core");
+
+    // Blocks split rows and quoted fields at arbitrary offsets
+    FILE *f = fopen(gz, "wb");
+    FILE *fb = fopen(bad, "wb");
+    if (!plain || !f || !fb) {
+        if (f) fclose(f);
+        if (fb) fclose(fb);
+        free(csv);
+        FAIL("failed to create temp files");
+        return;
+    }
+    for (size_t off = 0; off < len; off += 50001) {
+        write_bgzf_member(f, (const uint8_t *)csv + off, len - off < 50001 ? len - off : 50001);
+    }
+    write_bgzf_member(f, NULL, 0);  // BGZF end-of-file marker
+    fclose(f);
+    write_bgzf_member(fb, (const uint8_t *)csv, 60000);
+    fseek(fb, -6, SEEK_END);
+    put_le(fb, 0xdeadbeefu, 4);     // corrupt CRC
+    fclose(fb);
+    free(csv);
+
+    read_digest_t ref, par, seq;
+    ok = ok && parse_digest(&ref, plain, -1, NULL) == 0 && ref.rows > 0;
+    int rc_par = compressed_digest(&par, gz, 4);
+    int rc_seq = compressed_digest(&seq, gz, 1);
+    read_digest_t junk;
+    int rc_bad = compressed_digest(&junk, bad, 1);
+    unlink(plain);
+    unlink(gz);
+    unlink(bad);
+
+    if (ok && rc_par == -ENOTSUP) {
+        // Built without zlib: nothing more to check
+        PASS();
+        return;
+    }
+    ok = ok && rc_par == 0 && rc_seq == 0 && rc_bad == -EBADMSG &&
+         par.hash == ref.hash && par.rows == ref.rows &&
+         seq.hash == ref.hash && seq.rows == ref.rows;
+    if (ok) {
+        PASS();
+    } else {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "rc par=%d seq=%d bad=%d rows=%zu/%zu/%zu",
+                 rc_par, rc_seq, rc_bad, par.rows, seq.rows, ref.rows);
+        FAIL(buf);
+    }
+}
+
+typedef struct {
+    read_digest_t digest;        // first, so the digest callbacks accept it
+    const uint8_t **chunks;      // chunks in write order
+    size_t written;
+    size_t released;
+    bool out_of_order;
+} pinned_digest_t;
+
+static void pinned_release(void *user, const uint8_t *chunk, size_t len) {
+    (void)len;
+    pinned_digest_t *pd = user;
+    if (pd->released >= pd->written || pd->chunks[pd->released] != chunk) pd->out_of_order = true;
+    pd->released++;
+    free((void *)chunk);
+}
+
+void test_pinned_streaming(void) {
+    TEST("pinned streaming matches parse_file and releases every chunk");
+
+    size_t cap = 24 * 1024, len = 0;
+    char *csv = malloc(cap);
+    if (!csv) { FAIL("alloc failed"); return; }
+    for (int i = 0; len + 128 < cap - 1; i++) {
+        len += (size_t)snprintf(csv + len, cap - len,
+                                i % 5 == 0 ? "%d,\"pinned \"\"%d\"\",\nspans\",%.*s\r\n"
+                                           : "%d,plain %d,%.*s\n",
+                                i, i * 7, i % 90,
+                                "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+                                "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq");
+    }
+    csv[len] = '\0';
+    const char *path = write_temp_csv(csv);
+
+    read_digest_t ref;
+    int ok = path && parse_digest(&ref, path, -1, NULL) == 0 && ref.rows > 0;
+    if (path) unlink(path);
+
+    pinned_digest_t pd = { { 14695981039346656037ULL, 0, 0 }, NULL, 0, 0, false };
+    pd.chunks = malloc(len * sizeof(*pd.chunks));
+    cisv_config config;
+    cisv_config_init(&config);
+    config.field_cb = read_digest_field;
+    config.row_cb = read_digest_row;
+    config.release_cb = pinned_release;
+    config.user = &pd;
+    cisv_parser *parser = pd.chunks ? cisv_parser_create_with_config(&config) : NULL;
+    ok = ok && parser;
+
+    // Chunk sizes from 1 to 150 bytes so fields span zero, one or many chunks
+    for (size_t off = 0, i = 0; ok && off < len; i++) {
+        size_t n = 1 + (i * 37) % 150;
+        if (n > len - off) n = len - off;
+        uint8_t *chunk = malloc(n);
+        if (!chunk) { ok = 0; break; }
+        memcpy(chunk, csv + off, n);
+        pd.chunks[pd.written++] = chunk;
+        ok = cisv_parser_write(parser, chunk, n) == 0;
+        off += n;
+    }
+    size_t before_end = pd.released;
+    if (parser) cisv_parser_end(parser);
+    cisv_parser_destroy(parser);
+    free(pd.chunks);
+    free(csv);
+
+    ok = ok && before_end > 0 && pd.released == pd.written && !pd.out_of_order &&
+         pd.digest.hash == ref.hash && pd.digest.rows == ref.rows &&
+         pd.digest.fields == ref.fields;
+    if (ok) {
+        PASS();
+    } else {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "released=%zu/%zu order=%d rows=%zu/%zu",
+                 pd.released, pd.written, !pd.out_of_order, pd.digest.rows, ref.rows);
+        FAIL(buf);
+    }
+}
+
 int main(void) {
     printf("CISV Core Library Tests\n");
     printf("========================\n\n");
@@ -856,6 +2536,10 @@ int main(void) {
     test_transform_lowercase();
     test_transform_trim();
     test_transform_pipeline();
+    test_transform_arena();
+    test_transform_column();
+    test_transform_hash();
+    test_transform_aes();
     test_base64_encode();
 
     // Writer tests
@@ -878,6 +2562,27 @@ int main(void) {
     test_parse_comment_lines();
     test_max_row_size_skip_error_lines();
     test_parallel_custom_quote_chunk_split();
+    test_parallel_shared_pool();
+    test_parse_file_quote_heavy();
+    test_parse_file_stray_quote_matches_write();
+    test_structural_index_columns();
+    test_column_projection();
+    test_pool_morsels_in_file_order();
+    test_split_chunks_quote_parity();
+    test_pool_speculative_matches_serial();
+    test_pool_stream_in_order();
+    test_columnar_result();
+    test_arrow_export();
+    test_arrow_file_errors();
+    test_typed_columns();
+    test_typed_float_precision();
+    test_dictionary_columns();
+    test_iterator_batch_spans();
+    test_read_pipeline();
+    test_mmap_window();
+    test_io_strategy();
+    test_compressed_input();
+    test_pinned_streaming();
 
     // Summary
     printf("\n========================\n");
@@ -28,6 +28,7 @@ tests=(
     "test_compiler_flags.sh"
     "test_quote_buffer.sh"
     "test_cache.sh"
+    "test_pinned.sh"
     "perf_test_suite.sh"
 )
 